@@ -1178,6 +1178,18 @@ std::string HermesRuntime::getIOTrackingInfoJSON() {
   return buf;
 }
 
+void HermesRuntime::enableSamplingHeapProfiler(
+    size_t samplingInterval,
+    int64_t seed) {
+  static_cast<HermesRuntimeImpl *>(this)->runtime_.enableSamplingHeapProfiler(
+      samplingInterval, seed);
+}
+
+void HermesRuntime::disableSamplingHeapProfiler(llvm::raw_ostream &os) {
+  static_cast<HermesRuntimeImpl *>(this)->runtime_.disableSamplingHeapProfiler(
+      os);
+}
+
 #ifdef HERMESVM_PROFILER_BB
 void HermesRuntime::dumpBasicBlockProfileTrace(llvm::raw_ostream &os) const {
   static_cast<const HermesRuntimeImpl *>(this)
@@ -137,6 +137,19 @@ class HermesRuntime : public jsi::Runtime {
   /// needed for there to be useful output.
   std::string getIOTrackingInfoJSON();
 
+  /// Start sampling allocations for the sampling heap profiler, taking on
+  /// average one sample every \p samplingInterval bytes allocated. Only the
+  /// sampled allocations record a stack-trace, which keeps the overhead low.
+  /// \param seed If non-negative, seeds the sampling for reproducibility.
+  void enableSamplingHeapProfiler(
+      size_t samplingInterval = 1 << 15,
+      int64_t seed = -1);
+
+  /// Stop sampling allocations and write the profile of the sampled objects
+  /// which are still alive to \p os in the Chrome DevTools .heapprofile
+  /// format.
+  void disableSamplingHeapProfiler(llvm::raw_ostream &os);
+
 #ifdef HERMESVM_PROFILER_BB
   /// Write the trace to the given stream.
   void dumpBasicBlockProfileTrace(llvm::raw_ostream &os) const;
@@ -13,6 +13,10 @@
 #include "hermes/Support/SourceErrorManager.h"
 #include "hermes/Support/StringTable.h"
 
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/Twine.h"
+#include "llvm/Support/Path.h"
+
 namespace hermes {
 
 namespace hbc {
@@ -55,6 +59,52 @@ struct OutliningSettings {
   unsigned maxParameters{5};
 };
 
+/// Execution counts of a function, as recorded by the basic block profiler.
+struct FunctionExecutionCounts {
+  /// Number of times the function was invoked.
+  uint64_t entryCount{0};
+  /// Execution count of the most frequently executed basic block.
+  uint64_t maxBlockCount{0};
+};
+
+/// Execution counts of the functions of a program, keyed by
+/// getExecutionProfileKey().
+using ExecutionProfile = llvm::StringMap<FunctionExecutionCounts>;
+
+/// \return the key in an ExecutionProfile of the function \p name which
+/// starts at \p line and \p column of \p file. Unlike its ID, the start of a
+/// function identifies it across compilations of the same source. The name
+/// tells apart the global function from a function at the start of the file.
+/// Only the file name is used, so the profile still applies to a different
+/// checkout.
+inline std::string getExecutionProfileKey(
+    llvm::StringRef file,
+    unsigned line,
+    unsigned column,
+    llvm::StringRef name) {
+  return (llvm::sys::path::filename(file) + ":" + llvm::Twine(line) + ":" +
+          llvm::Twine(column) + ":" + name)
+      .str();
+}
+
+struct InliningSettings {
+  /// Inline small functions which are called from more than one call site.
+  bool multipleCallSites{true};
+  /// Maximum size (number of instructions) of a function inlined into a
+  /// call site of unknown hotness.
+  unsigned maxCalleeSize{12};
+  /// Maximum size of a function inlined into a hot call site.
+  unsigned maxHotCalleeSize{48};
+  /// Maximum growth of the number of instructions in the module, in percent.
+  unsigned maxGrowthPercent{10};
+  /// Minimum number of invocations of a function for calls to it to be
+  /// considered hot.
+  uint64_t hotCallCount{1000};
+  /// Optional execution profile. When it is present, call sites which were
+  /// never executed are not inlined.
+  std::shared_ptr<const ExecutionProfile> profile{};
+};
+
 struct OptimizationSettings {
   /// Enable constant property optimization
   bool constantPropertyOptimizations{false};
@@ -74,6 +124,9 @@ struct OptimizationSettings {
   /// Enable any inlining of functions.
   bool inlining{true};
 
+  /// Specific settings for the inliner.
+  InliningSettings inliningSettings;
+
   /// Enable IR outlining.
   bool outlining{false};
 
@@ -83,6 +136,10 @@ struct OptimizationSettings {
   /// Reuse property cache entries for same property name.
   bool reusePropCache{true};
 
+  /// Fuse common instruction sequences into superinstructions in the
+  /// bytecode.
+  bool superInstructions{true};
+
   /// Recognize calls to global functions like Object.keys() and turn them
   /// into builtin calls.
   bool staticBuiltins{false};
@@ -20,6 +20,7 @@
 #include "llvm/ADT/ArrayRef.h"
 
 #include <atomic>
+#include <mutex>
 #include <thread>
 
 #ifdef HERMESVM_SERIALIZE
@@ -146,6 +147,13 @@ class BCProviderBase {
   /// We can use this to throw an exception to JSI.
   std::string errstr_{};
 
+  /// Guards the computation of runtimeIdentifierHashes_.
+  std::once_flag runtimeIdentifierHashesOnce_;
+
+  /// The runtimeHashString() of every identifier, in the order of
+  /// identifierHashes_. Computed when first needed.
+  std::vector<uint32_t> runtimeIdentifierHashes_;
+
   /// Create the global debug info data, called only when first time needed.
   virtual void createDebugInfo() = 0;
 
@@ -242,6 +250,12 @@ class BCProviderBase {
   virtual const hbc::DebugOffsets *getDebugOffsets(
       uint32_t functionID) const = 0;
 
+  /// \return the runtimeHashString() of every identifier in the string
+  /// table, in the order of getIdentifierHashes(). They are computed on the
+  /// first call, and then shared by all the runtimes which use this provider.
+  /// Thread-safe.
+  llvm::ArrayRef<uint32_t> getRuntimeIdentifierHashes();
+
   /// Get the source text location of address \p offsetInFunction in funciton
   /// \p funcId.
   llvm::Optional<SourceMapTextLocation> getLocationForAddress(
@@ -30,7 +30,7 @@ const static uint64_t DELTA_MAGIC = ~MAGIC;
 
 // Bytecode version generated by this version of the compiler.
 // Updated: Dec 19, 2019
-const static uint32_t BYTECODE_VERSION = 74;
+const static uint32_t BYTECODE_VERSION = 76;
 
 /// Property cache index which indicates no caching.
 static constexpr uint8_t PROPERTY_CACHING_DISABLED = 0;
@@ -197,6 +197,11 @@ class DebugInfo {
       uint32_t debugOffset,
       uint32_t offsetInFunction) const;
 
+  /// Get the location where the function starts, given the function's debug
+  /// offset.
+  OptValue<DebugSourceLocation> getLocationForFunction(
+      uint32_t debugOffset) const;
+
   /// Given a \p targetLine and optional \p targetColumn,
   /// find a bytecode address at which that location is listed in debug info.
   /// If \p targetColumn is None, then it tries to match at the first location
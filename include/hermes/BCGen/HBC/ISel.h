@@ -102,6 +102,11 @@ class HBCISel {
   /// Saved identifier of "__proto__" for fast comparisons.
   Identifier protoIdent_{};
 
+  /// The arithmetic instruction of the current basic block which will be
+  /// emitted as part of a superinstruction with the block terminator, or
+  /// nullptr. See findFusibleArithmetic().
+  BinaryOperatorInst *fusedArithmetic_{nullptr};
+
   /// Encode a value into a param_t type.
   unsigned encodeValue(Value *);
 
@@ -146,6 +151,24 @@ class HBCISel {
   /// In debug mode, assert that parameters have been correctly allocated.
   void verifyCall(CallInst *Inst);
 
+  /// Find an AddN/SubN instruction which can be emitted together with the
+  /// compare-and-branch \p CBI as an arithmetic conditional jump.
+  /// The arithmetic must produce the left operand of the comparison and may
+  /// only be followed by register moves which don't interfere with it, since
+  /// it will be delayed until the branch.
+  /// \param next the basic block which will be emitted after this one.
+  /// \return the arithmetic instruction, or nullptr if there is none.
+  BinaryOperatorInst *findFusibleArithmetic(
+      CompareBranchInst *CBI,
+      BasicBlock *next);
+
+  /// Emit the compare-and-branch \p Inst together with the arithmetic
+  /// instruction \p arith found by findFusibleArithmetic().
+  void generateArithCompareBranch(
+      CompareBranchInst *Inst,
+      BinaryOperatorInst *arith,
+      BasicBlock *next);
+
   /// The last emitted property cache index.
   uint8_t lastPropertyReadCacheIndex_{0};
   uint8_t lastPropertyWriteCacheIndex_{0};
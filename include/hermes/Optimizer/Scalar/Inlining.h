@@ -13,7 +13,8 @@
 
 namespace hermes {
 
-/// Inline single use functions.
+/// Inline single use functions, as well as small functions with multiple call
+/// sites, guided by a code size budget and an optional execution profile.
 class Inlining : public ModulePass {
  public:
   explicit Inlining() : hermes::ModulePass("Inlining") {}
@@ -10,6 +10,7 @@
 
 #include "hermes/Support/OptValue.h"
 
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/MathExtras.h"
 
@@ -287,6 +288,123 @@ OptValue<double> parseIntWithRadix(Iterable str, int radix) {
   return result;
 }
 
+/// Compute the double closest to \p mantissa * 10^\p exp10, negated if
+/// \p negative, with the Eisel-Lemire algorithm.
+/// \param truncated whether \p mantissa is the truncation of a decimal number
+///   with more significant digits, which are not all zero.
+/// \return false if the result cannot be determined this way, which happens
+///   for subnormal and out of range results and for a few numbers which are
+///   very close to halfway between two doubles.
+bool decimalToDouble(
+    uint64_t mantissa,
+    int exp10,
+    bool negative,
+    bool truncated,
+    double &result);
+
+/// Parse the NUL-terminated decimal number \p str with strtod().
+double parseDecimalSlowPath(const char *str);
+
+/// Parse the longest prefix of [\p begin, \p end) which is a decimal number:
+/// an optional sign, digits with an optional decimal point, and an optional
+/// exponent. Unlike strtod(), it does not accept hex numbers, Infinity or NaN.
+/// Numbers with up to 19 significant digits are converted without copying or
+/// allocating.
+/// \param[out] result the parsed number, correctly rounded.
+/// \return the end of the prefix, or \p begin if there is no number.
+template <typename CharT>
+const CharT *
+parseDecimalPrefix(const CharT *begin, const CharT *end, double &result) {
+  const CharT *it = begin;
+  bool negative = false;
+  if (it != end && (*it == '+' || *it == '-')) {
+    negative = *it == '-';
+    ++it;
+  }
+
+  // The first 19 significant digits, which always fit in 64 bits.
+  const unsigned kMaxDigits = 19;
+  uint64_t mantissa = 0;
+  unsigned numDigits = 0;
+  bool truncated = false;
+  // The decimal exponent of the last digit in mantissa.
+  int exp10 = 0;
+  bool anyDigits = false;
+  for (; it != end && *it >= '0' && *it <= '9'; ++it) {
+    anyDigits = true;
+    if (numDigits < kMaxDigits) {
+      mantissa = mantissa * 10 + (*it - '0');
+      numDigits += mantissa != 0;
+    } else {
+      ++exp10;
+      truncated |= *it != '0';
+    }
+  }
+  if (it != end && *it == '.') {
+    const CharT *fractionBegin = ++it;
+    for (; it != end && *it >= '0' && *it <= '9'; ++it) {
+      if (numDigits < kMaxDigits) {
+        mantissa = mantissa * 10 + (*it - '0');
+        numDigits += mantissa != 0;
+        --exp10;
+      } else {
+        truncated |= *it != '0';
+      }
+    }
+    anyDigits |= it != fractionBegin;
+  }
+  if (!anyDigits)
+    return begin;
+
+  if (it != end && (*it == 'e' || *it == 'E')) {
+    const CharT *expIt = it + 1;
+    bool expNegative = false;
+    if (expIt != end && (*expIt == '+' || *expIt == '-')) {
+      expNegative = *expIt == '-';
+      ++expIt;
+    }
+    // The exponent is only part of the number if it has digits.
+    if (expIt != end && *expIt >= '0' && *expIt <= '9') {
+      int exp = 0;
+      for (; expIt != end && *expIt >= '0' && *expIt <= '9'; ++expIt) {
+        // Larger exponents overflow or underflow anyway.
+        if (exp < 100000)
+          exp = exp * 10 + (*expIt - '0');
+      }
+      exp10 += expNegative ? -exp : exp;
+      it = expIt;
+    }
+  }
+
+  if (mantissa == 0) {
+    result = negative ? -0.0 : 0.0;
+    return it;
+  }
+
+  // Integers up to 2^53 and powers of ten up to 10^22 are exact doubles, so
+  // a single multiplication or division of them is correctly rounded.
+  static const double kPowersOfTen[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  if (!truncated && mantissa <= (1ull << 53) && exp10 >= -22 &&
+      exp10 <= 22) {
+    double value = static_cast<double>(mantissa);
+    value = exp10 < 0 ? value / kPowersOfTen[-exp10]
+                      : value * kPowersOfTen[exp10];
+    result = negative ? -value : value;
+    return it;
+  }
+  if (decimalToDouble(mantissa, exp10, negative, truncated, result))
+    return it;
+
+  llvm::SmallVector<char, 32> str8;
+  for (const CharT *p = begin; p != it; ++p)
+    str8.push_back(static_cast<char>(*p));
+  str8.push_back('\0');
+  result = parseDecimalSlowPath(str8.data());
+  return it;
+}
+
 } // namespace hermes
 
 #endif // HERMES_SUPPORT_CONVERSIONS_H
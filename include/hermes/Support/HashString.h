@@ -11,6 +11,10 @@
 #include "hermes/Support/JenkinsHash.h"
 
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/Support/Host.h"
+
+#include <cstring>
+#include <type_traits>
 
 namespace hermes {
 
@@ -26,6 +30,8 @@ namespace hermes {
 /// StringView::const_iterator to always return char16_t in the iterator.
 ///
 /// NOTE: If hashString is changed, the bytecode version must be bumped.
+/// The VM hashes strings with runtimeHashString() instead, so only the
+/// compiler depends on this function.
 template <typename T>
 uint32_t hashString(llvm::ArrayRef<T> str) {
   static_assert(
@@ -57,6 +63,108 @@ constexpr uint32_t constexprHashString(const char (&str)[Count]) {
   return hash_details::constexprHashStringHelper<Count - 1>(str);
 }
 
+namespace hash_details {
+/// The runtime hash consumes the string four code units at a time, as a
+/// 64-bit word of four 16-bit lanes with the first code unit in the lowest
+/// lane. ASCII code units are zero-extended, so an ASCII string and a UTF-16
+/// string with the same contents produce the same words.
+constexpr uint64_t kRuntimeHashMul = 0x9e3779b97f4a7c15ull;
+
+constexpr uint64_t runtimeHashRotate(uint64_t x) {
+  return x << 31 | x >> 33;
+}
+
+/// Mix \p word into the state \p h. The rotation brings the well-mixed high
+/// bits of the product down, so that the next multiplication spreads them.
+constexpr uint64_t runtimeHashMix(uint64_t h, uint64_t word) {
+  return runtimeHashRotate((h ^ word) * kRuntimeHashMul);
+}
+
+constexpr uint64_t runtimeHashShiftXor(uint64_t x) {
+  return x ^ (x >> 33);
+}
+
+/// Fold the length into the final state \p h and avalanche it (MurmurHash3's
+/// 64-bit finalizer), since hash tables index with the low bits of the hash.
+constexpr uint32_t runtimeHashFinish(uint64_t h, std::size_t length) {
+  return (uint32_t)runtimeHashShiftXor(
+      runtimeHashShiftXor(
+          runtimeHashShiftXor(h ^ length) * 0xff51afd7ed558ccdull) *
+      0xc4ceb9fe1a85ec53ull);
+}
+
+/// \return the word made of the \p n (at most 4) code units at \p str.
+template <typename T>
+constexpr uint64_t runtimeHashWord(const T *str, std::size_t n) {
+  return n == 0 ? 0
+                : (uint64_t)(typename std::make_unsigned<T>::type)str[0] |
+          runtimeHashWord(str + 1, n - 1) << 16;
+}
+
+/// \return the word made of the 4 code units at \p str.
+inline uint64_t runtimeHashLoad(const char16_t *str) {
+  if (!llvm::sys::IsLittleEndianHost)
+    return runtimeHashWord(str, 4);
+  uint64_t word;
+  std::memcpy(&word, str, sizeof(word));
+  return word;
+}
+
+/// \return the word made of the 4 code units at \p str, zero-extending
+/// each byte into its 16-bit lane.
+inline uint64_t runtimeHashLoad(const char *str) {
+  if (!llvm::sys::IsLittleEndianHost)
+    return runtimeHashWord(str, 4);
+  uint32_t bytes;
+  std::memcpy(&bytes, str, sizeof(bytes));
+  uint64_t word = bytes;
+  word = (word | word << 16) & 0x0000ffff0000ffffull;
+  word = (word | word << 8) & 0x00ff00ff00ff00ffull;
+  return word;
+}
+
+constexpr uint32_t constexprRuntimeHashHelper(
+    const char *str,
+    std::size_t length,
+    std::size_t pos,
+    uint64_t h) {
+  return length - pos >= 4
+      ? constexprRuntimeHashHelper(
+            str,
+            length,
+            pos + 4,
+            runtimeHashMix(h, runtimeHashWord(str + pos, 4)))
+      : runtimeHashFinish(
+            runtimeHashMix(h, runtimeHashWord(str + pos, length - pos)),
+            length);
+}
+} // namespace hash_details
+
+/// Computes a hash of \p str for use by the VM, such as in the identifier
+/// table. Unlike hashString(), this hash is never stored in bytecode, so it
+/// may be changed freely. It processes four code units per step, and an ASCII
+/// string hashes to the same value as the UTF-16 string with the same
+/// contents.
+template <typename T>
+uint32_t runtimeHashString(llvm::ArrayRef<T> str) {
+  using namespace hash_details;
+  const T *s = str.data();
+  const std::size_t length = str.size();
+  uint64_t h = 0;
+  std::size_t i = 0;
+  for (; length - i >= 4; i += 4)
+    h = runtimeHashMix(h, runtimeHashLoad(s + i));
+  return runtimeHashFinish(
+      runtimeHashMix(h, runtimeHashWord(s + i, length - i)), length);
+}
+
+/// Return the runtimeHashString() of \p str, at compile time.
+template <std::size_t Count>
+constexpr uint32_t constexprRuntimeHashString(const char (&str)[Count]) {
+  // Count-1 accounts for terminating NUL.
+  return hash_details::constexprRuntimeHashHelper(str, Count - 1, 0, 0);
+}
+
 } // namespace hermes
 
 #endif
@@ -8,6 +8,7 @@
 #ifndef HERMES_SUPPORT_OSCOMPAT_H
 #define HERMES_SUPPORT_OSCOMPAT_H
 
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/ErrorOr.h"
@@ -102,12 +103,20 @@ enum class ProtectMode { ReadWrite, None };
 /// false on error.
 bool vm_protect(void *p, size_t sz, ProtectMode mode);
 
-enum class MAdvice { Random, Sequential };
+/// HugePage asks for the region to be backed by transparent huge pages where
+/// the OS supports them.
+enum class MAdvice { Random, Sequential, HugePage };
 
 /// Issue an madvise() call.
 /// \return true on success, false on error.
 bool vm_madvise(void *p, size_t sz, MAdvice advice);
 
+/// Ask the OS to allocate the pages of the \p sz byte region starting at \p p
+/// on NUMA node \p node when it can, falling back to other nodes when that
+/// node is out of memory. \p p must be page-aligned.
+/// \return true on success, false on error (including not supported).
+bool vm_prefer_numa_node(void *p, size_t sz, int node);
+
 /// Return the number of pages in the given region that are currently in RAM.
 /// If \p runs is provided, then populate it with the lengths of runs of
 /// consecutive pages with the same resident/non-resident status, alternating
@@ -120,6 +129,15 @@ int pages_in_ram(
     size_t sz,
     llvm::SmallVectorImpl<int> *runs = nullptr);
 
+/// Return the number of bytes in the given regions that are currently backed
+/// by transparent huge pages. Each region is a pair of a start address and a
+/// size in bytes. \p regions must be sorted by start address and must not
+/// overlap.
+///
+/// Return -1 on failure (including not supported).
+int64_t huge_pages_in_ram(
+    llvm::ArrayRef<std::pair<const void *, size_t>> regions);
+
 /// Resident set size (RSS), in bytes: the amount of RAM used by the process.
 /// It excludes virtual memory that has been paged out or was never loaded.
 /// \return Peak RSS usage throughout this process's history.
@@ -165,6 +183,10 @@ std::vector<bool> sched_getaffinity();
 /// or -1 on error.
 int sched_getcpu();
 
+/// \return the NUMA node of the CPU core where this thread is currently
+/// scheduled, or -1 on error (including not supported).
+int numa_node();
+
 /// Converts a value to its string representation.  Only works for
 /// numeric values, e.g. 0 becomes "0", not '\0'.
 ///
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+//===----------------------------------------------------------------------===//
+/// \file
+/// Substring search over strings of 8-bit or 16-bit code units.
+///
+/// The haystack and the needle may have different code unit types, and code
+/// units are compared by their unsigned value. The strategy depends on the
+/// shape of the search:
+/// - Needles of one code unit are found with memchr() in 8-bit haystacks, and
+///   by comparing four code units per 64-bit word in 16-bit haystacks.
+/// - Short needles are found by looking for their first code unit (again with
+///   memchr() or word-at-a-time scanning) and checking the last code unit
+///   before comparing the rest, which rejects almost every candidate with a
+///   single compare.
+/// - Long needles in long haystacks use Boyer-Moore-Horspool, which skips
+///   ahead by up to the length of the needle at every step. The skip table is
+///   indexed by the low byte of a code unit, which only ever makes a skip
+///   shorter for 16-bit strings, never incorrect.
+//===----------------------------------------------------------------------===//
+
+#ifndef HERMES_SUPPORT_STRINGSEARCH_H
+#define HERMES_SUPPORT_STRINGSEARCH_H
+
+#include "llvm/ADT/ArrayRef.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace hermes {
+
+/// Returned by the search functions when there is no match.
+constexpr size_t kStringSearchNoMatch = ~(size_t)0;
+
+namespace string_search_details {
+
+/// Needles at least this long are searched with Boyer-Moore-Horspool.
+constexpr size_t kMinHorspoolNeedle = 8;
+/// Building the skip table doesn't pay off for short haystacks.
+constexpr size_t kMinHorspoolHaystack = 512;
+
+/// \return the code unit \p c as an unsigned value.
+template <typename T>
+inline typename std::make_unsigned<T>::type unit(T c) {
+  return static_cast<typename std::make_unsigned<T>::type>(c);
+}
+
+/// \return the index of the skip table entry for the code unit \p c.
+template <typename T>
+inline uint8_t skipIndex(T c) {
+  return static_cast<uint8_t>(unit(c));
+}
+
+/// \return true if every code unit of \p needle can occur in a string with
+///   code units of type \p HayT.
+template <typename HayT, typename NeedleT>
+inline bool fitsIn(llvm::ArrayRef<NeedleT> needle) {
+  using HayU = typename std::make_unsigned<HayT>::type;
+  if (sizeof(HayT) >= sizeof(NeedleT))
+    return true;
+  for (NeedleT c : needle) {
+    if (unit(c) > std::numeric_limits<HayU>::max())
+      return false;
+  }
+  return true;
+}
+
+/// \return true if the \p n code units at \p a and \p b are equal.
+template <typename HayT, typename NeedleT>
+inline bool rangeEquals(const HayT *a, const NeedleT *b, size_t n) {
+  if (sizeof(HayT) == sizeof(NeedleT))
+    return std::memcmp(a, b, n * sizeof(HayT)) == 0;
+  for (size_t i = 0; i < n; ++i) {
+    if (unit(a[i]) != unit(b[i]))
+      return false;
+  }
+  return true;
+}
+
+/// \return the index of the first occurrence of \p c in \p hay at or after
+///   \p from, or kStringSearchNoMatch.
+template <typename HayT, typename C>
+inline size_t findUnit(llvm::ArrayRef<HayT> hay, C c, size_t from) {
+  if (sizeof(HayT) == 1) {
+    const void *found =
+        std::memchr(hay.data() + from, (int)unit(c), hay.size() - from);
+    return found ? (const HayT *)found - hay.data() : kStringSearchNoMatch;
+  }
+  size_t i = from;
+  if (sizeof(HayT) == 2) {
+    // Compare four code units at a time: after XOR with the pattern, a
+    // matching code unit is a zero 16-bit lane, which the classic "has zero"
+    // bit trick detects without false negatives.
+    constexpr uint64_t kLows = 0x0001000100010001ull;
+    constexpr uint64_t kHighs = 0x8000800080008000ull;
+    const uint64_t pattern = kLows * unit(c);
+    for (size_t e = hay.size(); e - i >= 4; i += 4) {
+      uint64_t word;
+      std::memcpy(&word, hay.data() + i, sizeof(word));
+      word ^= pattern;
+      if ((word - kLows) & ~word & kHighs)
+        break;
+    }
+  }
+  for (size_t e = hay.size(); i < e; ++i) {
+    if (unit(hay[i]) == unit(c))
+      return i;
+  }
+  return kStringSearchNoMatch;
+}
+
+/// Forward search for a needle of at least two code units, filtering the
+/// candidates by their first and last code units.
+template <typename HayT, typename NeedleT>
+size_t searchFirstLast(
+    llvm::ArrayRef<HayT> hay,
+    llvm::ArrayRef<NeedleT> needle,
+    size_t from) {
+  const size_t n = needle.size();
+  const size_t lastStart = hay.size() - n;
+  const auto last = unit(needle[n - 1]);
+  // Only look for the first code unit where a match could start.
+  auto candidates = hay.slice(0, lastStart + 1);
+  for (size_t pos = from; pos <= lastStart; ++pos) {
+    pos = findUnit(candidates, needle[0], pos);
+    if (pos == kStringSearchNoMatch)
+      break;
+    if (unit(hay[pos + n - 1]) == last &&
+        rangeEquals(hay.data() + pos + 1, needle.data() + 1, n - 2))
+      return pos;
+  }
+  return kStringSearchNoMatch;
+}
+
+/// Forward Boyer-Moore-Horspool search.
+template <typename HayT, typename NeedleT>
+size_t searchHorspool(
+    llvm::ArrayRef<HayT> hay,
+    llvm::ArrayRef<NeedleT> needle,
+    size_t from) {
+  const size_t n = needle.size();
+  uint32_t skip[256];
+  for (auto &s : skip)
+    s = n;
+  for (size_t i = 0; i + 1 < n; ++i)
+    skip[skipIndex(needle[i])] = n - 1 - i;
+
+  const auto last = unit(needle[n - 1]);
+  for (size_t pos = from, lastStart = hay.size() - n; pos <= lastStart;) {
+    auto c = hay[pos + n - 1];
+    if (unit(c) == last && rangeEquals(hay.data() + pos, needle.data(), n - 1))
+      return pos;
+    pos += skip[skipIndex(c)];
+  }
+  return kStringSearchNoMatch;
+}
+
+/// Backward search for a needle of at least two code units, filtering the
+/// candidates by their first and last code units.
+template <typename HayT, typename NeedleT>
+size_t searchFirstLastBackward(
+    llvm::ArrayRef<HayT> hay,
+    llvm::ArrayRef<NeedleT> needle,
+    size_t start) {
+  const size_t n = needle.size();
+  const auto first = unit(needle[0]);
+  const auto last = unit(needle[n - 1]);
+  for (size_t pos = start + 1; pos-- > 0;) {
+    if (unit(hay[pos]) == first && unit(hay[pos + n - 1]) == last &&
+        rangeEquals(hay.data() + pos + 1, needle.data() + 1, n - 2))
+      return pos;
+  }
+  return kStringSearchNoMatch;
+}
+
+/// Backward Boyer-Moore-Horspool search, which matches the needle from its
+/// end and skips based on the first code unit of the candidate.
+template <typename HayT, typename NeedleT>
+size_t searchHorspoolBackward(
+    llvm::ArrayRef<HayT> hay,
+    llvm::ArrayRef<NeedleT> needle,
+    size_t start) {
+  const size_t n = needle.size();
+  uint32_t skip[256];
+  for (auto &s : skip)
+    s = n;
+  for (size_t i = n - 1; i > 0; --i)
+    skip[skipIndex(needle[i])] = i;
+
+  const auto first = unit(needle[0]);
+  for (size_t pos = start;;) {
+    auto c = hay[pos];
+    if (unit(c) == first &&
+        rangeEquals(hay.data() + pos + 1, needle.data() + 1, n - 1))
+      return pos;
+    size_t s = skip[skipIndex(c)];
+    if (pos < s)
+      break;
+    pos -= s;
+  }
+  return kStringSearchNoMatch;
+}
+
+} // namespace string_search_details
+
+/// Find the first occurrence of \p needle in \p hay which starts at or after
+/// \p from.
+/// \return the index of the match, or kStringSearchNoMatch. An empty needle
+///   matches at \p from if it is within \p hay.
+template <typename HayT, typename NeedleT>
+size_t stringSearch(
+    llvm::ArrayRef<HayT> hay,
+    llvm::ArrayRef<NeedleT> needle,
+    size_t from = 0) {
+  namespace d = string_search_details;
+  const size_t n = needle.size();
+  if (from > hay.size() || n > hay.size() - from)
+    return kStringSearchNoMatch;
+  if (n == 0)
+    return from;
+  if (!d::fitsIn<HayT>(needle))
+    return kStringSearchNoMatch;
+  if (n == 1)
+    return d::findUnit(hay, needle[0], from);
+  if (n >= d::kMinHorspoolNeedle &&
+      hay.size() - from >= d::kMinHorspoolHaystack)
+    return d::searchHorspool(hay, needle, from);
+  return d::searchFirstLast(hay, needle, from);
+}
+
+/// Find the last occurrence of \p needle in \p hay which starts at or before
+/// \p start.
+/// \return the index of the match, or kStringSearchNoMatch. An empty needle
+///   matches at \p start, or at the end of \p hay if \p start is past it.
+template <typename HayT, typename NeedleT>
+size_t stringSearchBackward(
+    llvm::ArrayRef<HayT> hay,
+    llvm::ArrayRef<NeedleT> needle,
+    size_t start = kStringSearchNoMatch) {
+  namespace d = string_search_details;
+  const size_t n = needle.size();
+  if (n > hay.size())
+    return kStringSearchNoMatch;
+  start = std::min(start, hay.size() - n);
+  if (n == 0)
+    return start;
+  if (!d::fitsIn<HayT>(needle))
+    return kStringSearchNoMatch;
+  if (n == 1) {
+    for (size_t pos = start + 1; pos-- > 0;) {
+      if (d::unit(hay[pos]) == d::unit(needle[0]))
+        return pos;
+    }
+    return kStringSearchNoMatch;
+  }
+  if (n >= d::kMinHorspoolNeedle && start >= d::kMinHorspoolHaystack)
+    return d::searchHorspoolBackward(hay, needle, start);
+  return d::searchFirstLastBackward(hay, needle, start);
+}
+
+} // namespace hermes
+
+#endif // HERMES_SUPPORT_STRINGSEARCH_H
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_VM_BACKGROUNDFINALIZER_H
+#define HERMES_VM_BACKGROUNDFINALIZER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hermes {
+namespace vm {
+
+/// Runs the parts of finalizers which only release native resources (freeing
+/// buffers, destroying host objects) on a background thread, so that they
+/// don't lengthen GC pauses.
+/// The GC adds releases while it finalizes cells, and submits them all at the
+/// end of the collection. Adding releases is not thread-safe, and must only be
+/// done by the thread owning the heap.
+class BackgroundFinalizer {
+ public:
+  /// A function which releases the native resources in its argument.
+  using ReleaseFunc = void (*)(void *);
+
+  BackgroundFinalizer();
+
+  /// Runs all the releases which have been added, and stops the thread.
+  ~BackgroundFinalizer();
+
+  /// Add a call of \p release on \p context, to run on the background thread
+  /// after the next submit().
+  void add(ReleaseFunc release, void *context) {
+    batch_.push_back(Release{release, context});
+  }
+
+  /// Hand the releases added since the last call to the background thread.
+  void submit();
+
+  /// Submit, and wait until all releases have been run.
+  void drain();
+
+  /// \return the number of releases run so far.
+  uint64_t numReleased();
+
+  /// \return the time spent running releases so far, in seconds.
+  double releaseSecs();
+
+ private:
+  struct Release {
+    ReleaseFunc release;
+    void *context;
+  };
+
+  /// The code to run in the background thread.
+  void run();
+
+  /// Releases added since the last submit(). Only accessed by the thread
+  /// owning the heap.
+  std::vector<Release> batch_;
+
+  /// Guards all the fields below.
+  std::mutex mutex_;
+  /// Notified when there are releases to run, or the thread should stop.
+  std::condition_variable workAvailable_;
+  /// Notified when the background thread has run all the releases.
+  std::condition_variable idle_;
+
+  /// Releases submitted but not started yet.
+  std::vector<Release> queue_;
+  /// Whether the background thread is running releases.
+  bool busy_{false};
+  /// Set to make the background thread exit once the queue is empty.
+  bool stop_{false};
+
+  uint64_t numReleased_{0};
+  double releaseSecs_{0.0};
+
+  std::thread thread_;
+};
+
+} // namespace vm
+} // namespace hermes
+
+#endif // HERMES_VM_BACKGROUNDFINALIZER_H
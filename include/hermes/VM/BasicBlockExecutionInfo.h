@@ -90,8 +90,9 @@ class BasicBlockExecutionInfo {
     ++blockStat.first;
   }
 
-  /// Dump the statistics to \p OS in json format.
-  void dump(llvm::raw_ostream &OS);
+  /// Dump the statistics to \p OS in json format. \p runtime is used to
+  /// look up the names of the functions.
+  void dump(llvm::raw_ostream &OS, Runtime *runtime);
 };
 
 } // namespace vm
@@ -535,9 +535,22 @@ class NativeFunction : public Callable {
     auto t1 = HERMESVM_RDTSC();
 #endif
 
+#ifdef HERMESVM_PROFILER_OPCODE
+    OpcodeProfilerExclusion opcodeProfilerExclusion{
+        runtime->opcodeProfilerExcludedCycles};
+#endif
+
     auto res =
         self->functionPtr_(self->context_, runtime, newFrame.getNativeArgs());
 
+#ifdef HERMESVM_PROFILER_OPCODE
+    {
+      auto &profile = runtime->nativeCallProfile[(void *)self->functionPtr_];
+      ++profile.count;
+      profile.cycles += opcodeProfilerExclusion.selfCycles();
+    }
+#endif
+
 #ifdef HERMESVM_PROFILER_NATIVECALL
     self->callDuration_ = HERMESVM_RDTSC() - t1;
     ++self->callCount_;
@@ -1023,6 +1036,14 @@ class JSFunction : public Callable {
   void addLocationToSnapshot(HeapSnapshot &snap, HeapSnapshot::NodeID id) const;
 
  protected:
+  /// Create a new object for a construct call of this function, with its
+  /// property storage pre-sized from the allocation-site feedback recorded in
+  /// the function's CodeBlock.
+  static CallResult<PseudoHandle<JSObject>> _newObjectImpl(
+      Handle<Callable> selfHandle,
+      Runtime *runtime,
+      Handle<JSObject> parentHandle);
+
   /// Call the JavaScript function with arguments already on the stack.
   static CallResult<PseudoHandle<>> _callImpl(
       Handle<Callable> selfHandle,
@@ -1314,6 +1335,35 @@ class GeneratorInnerFunction final : public JSFunction {
   }
 };
 
+/// PreparedCall invokes the same Callable repeatedly from native code, as the
+/// iterating builtins do with their callbacks. When the callee is a
+/// JSFunction, its frame is set up once when the PreparedCall is constructed
+/// and each call only stores \c this and the arguments into it, and its
+/// CodeBlock is resolved once and run directly instead of going through the
+/// vtable. Other callees are called like executeCall() does.
+class PreparedCall {
+ public:
+  /// Prepare to call \p callee with \p argCount arguments.
+  PreparedCall(Runtime *runtime, Handle<Callable> callee, uint32_t argCount);
+
+  /// Call the callee with \p thisArg and \p args, which must have exactly as
+  /// many elements as were specified on construction. Raises a stack overflow
+  /// if the frame could not be allocated.
+  CallResult<PseudoHandle<>> call(
+      Handle<> thisArg,
+      llvm::ArrayRef<HermesValue> args);
+
+ private:
+  Runtime *const runtime_;
+  Handle<Callable> const callee_;
+
+  /// The code of the callee if it is a JSFunction, otherwise nullptr.
+  CodeBlock *const codeBlock_;
+
+  /// The frame passed to every call, if codeBlock_ is set.
+  llvm::Optional<ScopedNativeCallFrame> frame_;
+};
+
 } // namespace vm
 } // namespace hermes
 
@@ -71,6 +71,12 @@ class CodeBlock final
   /// cache.
   const uint32_t writePropCacheOffset_;
 
+  /// Allocation-site feedback for CreateThis: the largest number of property
+  /// slots observed on an object at the end of a construct call of this
+  /// function. Objects created for later construct calls preallocate this many
+  /// slots, so the constructor doesn't have to grow their property storage.
+  uint32_t constructedObjectSlots_ = 0;
+
 #ifndef HERMESVM_LEAN
   /// Compiles a lazy CodeBlock. Intended to be called from lazyCompile.
   void lazyCompileImpl(Runtime *runtime);
@@ -112,6 +118,14 @@ class CodeBlock final
   ProfilerID profilerID{NO_PROFILER_ID};
 #endif
 
+#ifdef HERMESVM_PROFILER_OPCODE
+  /// Number of instructions of this function executed by the interpreter.
+  uint64_t opcodeCount{0};
+  /// CPU cycles spent executing instructions of this function, including
+  /// their slow paths but not the functions they called.
+  uint64_t opcodeCycles{0};
+#endif
+
   /// Create a CodeBlock for a given runtime module \p runtimeModule. The result
   /// must be deallocated via delete, which is overridden.
   /// TODO: it would be nice to have this return a unique_ptr with a custom
@@ -336,6 +350,26 @@ class CodeBlock final
     return &propertyCache()[writePropCacheOffset_ + idx];
   }
 
+  /// Upper bound on the property slots preallocated from the feedback, so a
+  /// single large object doesn't inflate every later allocation. Objects with
+  /// more properties than this switch to dictionary mode anyway.
+  static constexpr uint32_t kMaxConstructedObjectSlots = 64;
+
+  /// \return the number of property slots to preallocate in an object created
+  /// for a construct call of this function.
+  uint32_t getConstructedObjectSlots() const {
+    return constructedObjectSlots_;
+  }
+
+  /// Record that a construct call of this function finished with an object
+  /// using \p numSlots property slots.
+  void recordConstructedObjectSlots(uint32_t numSlots) {
+    if (LLVM_UNLIKELY(numSlots > constructedObjectSlots_))
+      constructedObjectSlots_ = numSlots < kMaxConstructedObjectSlots
+          ? numSlots
+          : kMaxConstructedObjectSlots;
+  }
+
   // Mark all hidden classes in the property cache as roots.
   void markCachedHiddenClasses(Runtime *runtime, WeakRootAcceptor &acceptor);
 
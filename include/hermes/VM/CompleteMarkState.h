@@ -104,6 +104,10 @@ struct CompleteMarkState {
 
   /// The WeakMap objects that have been discovered to be reachable.
   std::vector<JSWeakMap *> reachableWeakMaps_;
+
+  /// While WeakMap marking is in progress, the table which is told about
+  /// every newly marked cell.  Null otherwise.
+  WeakMapEphemeronTable *ephemerons_ = nullptr;
 };
 
 /// Returns a heap acceptor for mark-sweep-compact pointer update.
@@ -112,6 +112,11 @@ class DecoratedObject : public JSObject {
   static void _finalizeImpl(GCCell *cell, GC *);
   static size_t _mallocSizeImpl(GCCell *cell);
 
+  /// Take ownership of the decoration, leaving none.
+  std::unique_ptr<Decoration> takeDecoration() {
+    return std::move(decoration_);
+  }
+
  private:
 #ifdef HERMESVM_SERIALIZE
   explicit DecoratedObject(Deserializer &d);
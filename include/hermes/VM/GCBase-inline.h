@@ -13,8 +13,7 @@
 #include "hermes/VM/JSWeakMapImpl.h"
 #include "hermes/VM/SkipWeakRefsAcceptor.h"
 
-#include "llvm/ADT/DenseMap.h"
-#include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/SmallVector.h"
 
 namespace hermes {
 namespace vm {
@@ -89,56 +88,6 @@ void GCBase::clearEntriesWithUnreachableKeys(
   }
 }
 
-/*static*/
-template <typename Acceptor, typename ObjIsMarkedFunc, typename MarkFromValFunc>
-bool GCBase::markFromReachableWeakMapKeys(
-    GC *gc,
-    JSWeakMap *weakMap,
-    Acceptor &acceptor,
-    llvm::DenseMap<JSWeakMap *, std::list<detail::WeakRefKey *>>
-        *unreachableKeys,
-    ObjIsMarkedFunc objIsMarked,
-    MarkFromValFunc markFromVal) {
-  std::list<detail::WeakRefKey *> *keyList = nullptr;
-  auto keyListIter = unreachableKeys->find(weakMap);
-  if (keyListIter == unreachableKeys->end()) {
-    (*unreachableKeys)[weakMap] = GCBase::buildKeyList(gc, weakMap);
-    keyList = &(*unreachableKeys)[weakMap];
-  } else {
-    keyList = &keyListIter->second;
-  }
-  bool newlyMarkedValue = false;
-  // Find any reachable keys, mark from the corresponding value, and
-  // remove them from the list.  (This removal is why we use a
-  // std::list for the keys -- this function is linear.)
-  keyList->remove_if([weakMap, gc, objIsMarked, markFromVal, &newlyMarkedValue](
-                         detail::WeakRefKey *key) {
-    GCCell *cell = key->getObject(gc);
-    if (!cell) {
-      // Remove key from list.
-      return true;
-    }
-
-    if (objIsMarked(cell)) {
-      GCHermesValue *valPtr = weakMap->getValueDirect(gc, *key);
-      assert(valPtr != nullptr && "Key is not in the map?");
-      if (valPtr->isPointer()) {
-        GCCell *valCell = reinterpret_cast<GCCell *>(valPtr->getPointer());
-
-        if (markFromVal(valCell, *valPtr)) {
-          newlyMarkedValue = true;
-        }
-      }
-
-      // Key was reachable; remove from list.
-      return true;
-    }
-    // Key was unreachable; do not remove from list.
-    return false;
-  });
-  return newlyMarkedValue;
-}
-
 /*static*/
 template <
     typename Acceptor,
@@ -150,74 +99,84 @@ gcheapsize_t GCBase::completeWeakMapMarking(
     GC *gc,
     Acceptor &acceptor,
     std::vector<JSWeakMap *> &reachableWeakMaps,
+    WeakMapEphemeronTable &ephemerons,
     ObjIsMarkedFunc objIsMarked,
     MarkFromValFunc markFromVal,
     DrainMarkStackFunc drainMarkStack,
     CheckMarkStackOverflowFunc checkMarkStackOverflow) {
-  // If a WeakMap is present as a key in this map, the corresponding list
-  // is a superset of the unreachable keys in the WeakMap.  (The set last
-  // found to be unreachable, some of which may now be reachable.)
-  llvm::DenseMap<JSWeakMap *, std::list<detail::WeakRefKey *>> unreachableKeys;
-
   /// A specialized acceptor, which does not mark weak refs.  We will
   /// revisit the WeakMaps with an acceptor that does, at the end.
   SkipWeakRefsAcceptor<Acceptor> skipWeakAcceptor(*gc, &acceptor);
 
-  // Must declare this outside the loop, but the initial value doesn't matter:
-  // we make it false at the start of each loop iteration.
-  bool newReachableValueFound = true;
-
-  // The set of weak maps that have already been scanned -- we do the
-  // initial scan of each weak map only once.
-  llvm::DenseSet<JSWeakMap *> scannedWeakMaps;
+  // Mark from the value of an entry whose key is known to be reachable.
+  auto markFromEntry = [gc, &ephemerons, markFromVal](
+                           JSWeakMap *weakMap, detail::WeakRefKey *key) {
+    GCHermesValue *valPtr = weakMap->getValueDirect(gc, *key);
+    assert(valPtr != nullptr && "Key is not in the map?");
+    if (valPtr->isPointer()) {
+      GCCell *valCell = reinterpret_cast<GCCell *>(valPtr->getPointer());
+      // markFromVal may mark the value cell without going through the
+      // collector's usual marking path, so report it here.
+      if (markFromVal(valCell, *valPtr)) {
+        ephemerons.cellMarked(valCell);
+      }
+    }
+  };
 
   /// The total size of the reachable WeakMaps.
   gcheapsize_t weakMapAllocBytes = 0;
-  do {
-    newReachableValueFound = false;
-    // Note that new reachable weak maps may be discovered during the loop, so
-    // reachableWeakMap.size() may increase during the loop.
-    for (unsigned i = 0; i < reachableWeakMaps.size(); i++) {
-      JSWeakMap *weakMap = reachableWeakMaps[i];
-
-      if (scannedWeakMaps.count(weakMap) == 0) {
-        weakMapAllocBytes += weakMap->getAllocatedSize();
-        // We need to scan the weak map here, to ensure that objects
-        // reachable from it (e.g., hidden class) are marked.  But we
-        // have to make one exception: the valueStorage field.  The
-        // whole point of weak map marking is to mark only the value
-        // fields that correspond to already-reachable keys; if we
-        // marked and drained, we would mark the value storage
-        // normally, and thus mark *all* objects reachable from it.
-        // So we temporarily null out the field, and restore it after.
-        auto &valueStorageRef = weakMap->getValueStorageRef(gc);
-        GCPointerBase::StorageType valueStorage = valueStorageRef;
-        valueStorageRef = GCPointer<BigStorage>(nullptr).getStorageType();
-        GCBase::markCell(weakMap, gc, skipWeakAcceptor);
-        drainMarkStack(acceptor);
-        valueStorageRef = valueStorage;
-        scannedWeakMaps.insert(weakMap);
-        // This handles an obscure potential bug: if we've already
-        // determined reachable keys for weak map 0, the scanning
-        // above of weak map 1 may have made otherwise-unreachable
-        // keys in weak map 0 reachable.  (Perhaps weak map 1 has a
-        // property that is also a key in map 0.)  Therefore, to be
-        // safe, make sure we make another pass through this loop
-        // whenever we do any scanning.
-        newReachableValueFound = true;
+  llvm::SmallVector<WeakMapEphemeronTable::Entry, 8> readyEntries;
+  // Alternate between scanning the WeakMaps found reachable, and marking the
+  // values of the entries whose keys have been marked since, until neither
+  // finds anything new.  Note that new reachable weak maps may be discovered
+  // at any point, so reachableWeakMaps.size() may increase during the loop.
+  for (size_t numScanned = 0;;) {
+    if (numScanned < reachableWeakMaps.size()) {
+      JSWeakMap *weakMap = reachableWeakMaps[numScanned++];
+      weakMapAllocBytes += weakMap->getAllocatedSize();
+      // We need to scan the weak map here, to ensure that objects
+      // reachable from it (e.g., hidden class) are marked.  But we
+      // have to make one exception: the valueStorage field.  The
+      // whole point of weak map marking is to mark only the value
+      // fields that correspond to already-reachable keys; if we
+      // marked and drained, we would mark the value storage
+      // normally, and thus mark *all* objects reachable from it.
+      // So we temporarily null out the field, and restore it after.
+      auto &valueStorageRef = weakMap->getValueStorageRef(gc);
+      GCPointerBase::StorageType valueStorage = valueStorageRef;
+      valueStorageRef = GCPointer<BigStorage>(nullptr).getStorageType();
+      GCBase::markCell(weakMap, gc, skipWeakAcceptor);
+      drainMarkStack(acceptor);
+      valueStorageRef = valueStorage;
+
+      // Mark from the values of the keys which are already reachable, and
+      // wait for the others to be marked.  Scanning this map may have marked
+      // the keys of entries pending in other maps (perhaps this map has a
+      // property that is also a key in another map); the collector has
+      // reported those to ephemerons.
+      for (auto iter = weakMap->keys_begin(), end = weakMap->keys_end();
+           iter != end;
+           iter++) {
+        GCCell *keyCell = iter->getObject(gc);
+        if (!keyCell) {
+          continue;
+        }
+        if (objIsMarked(keyCell)) {
+          markFromEntry(weakMap, &*iter);
+        } else {
+          ephemerons.addPending(keyCell, weakMap, &*iter);
+        }
       }
+      continue;
+    }
 
-      if (markFromReachableWeakMapKeys(
-              gc,
-              weakMap,
-              acceptor,
-              &unreachableKeys,
-              objIsMarked,
-              markFromVal)) {
-        newReachableValueFound = true;
-      }
+    if (!ephemerons.takeReadyEntries(readyEntries)) {
+      break;
+    }
+    for (const auto &entry : readyEntries) {
+      markFromEntry(entry.weakMap, entry.key);
     }
-  } while (newReachableValueFound);
+  }
 
   // If mark stack overflow occurred, terminate.
   if (checkMarkStackOverflow()) {
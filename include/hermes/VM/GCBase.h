@@ -16,6 +16,7 @@
 #include "hermes/Support/CheckedMalloc.h"
 #include "hermes/Support/OSCompat.h"
 #include "hermes/Support/StatsAccumulator.h"
+#include "hermes/VM/BackgroundFinalizer.h"
 #include "hermes/VM/BuildMetadata.h"
 #include "hermes/VM/CellKind.h"
 #include "hermes/VM/GCDecl.h"
@@ -32,6 +33,7 @@
 #include "hermes/VM/StorageProvider.h"
 #include "hermes/VM/StringRefUtils.h"
 #include "hermes/VM/VTable.h"
+#include "hermes/VM/WeakMapEphemeronTable.h"
 
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/DenseMap.h"
@@ -42,7 +44,6 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
-#include <list>
 #include <random>
 #include <system_error>
 #include <vector>
@@ -361,6 +362,12 @@ class GCBase {
     /// allocations continue to be tracked.
     inline void disable();
 
+    /// Returns true if any existing allocation has a stack-trace.
+    inline bool hasStackTraces() const;
+
+    /// Drop the stack-traces of all existing allocations.
+    inline void clear();
+
 #ifdef HERMESVM_SERIALIZE
     void serialize(Serializer &s) const;
     void deserialize(Deserializer &d);
@@ -377,6 +384,76 @@ class GCBase {
     bool enabled_{false};
   };
 
+  /// When enabled, the SamplingAllocationLocationTracker attaches a
+  /// stack-trace to a random sample of allocations. Samples are taken as a
+  /// Poisson process over allocated bytes, so on average one sample is taken
+  /// for every \c samplingInterval bytes allocated, and an allocation of size
+  /// S is sampled with probability roughly S / samplingInterval. Unlike
+  /// \c AllocationLocationTracker this does no per-allocation work beyond a
+  /// counter decrement, which makes it suitable for use in production.
+  struct SamplingAllocationLocationTracker final {
+    explicit inline SamplingAllocationLocationTracker(GCBase *gc);
+
+    /// Returns true if sampling of new allocations is enabled.
+    inline bool isEnabled() const;
+    /// Must be called by GC implementations whenever a new allocation is made.
+    inline void newAlloc(const void *ptr, uint32_t sz);
+    /// Must be called by GC implementations whenever an allocation is moved.
+    inline void moveAlloc(const void *oldPtr, const void *newPtr);
+    /// Must be called by GC implementations whenever an allocation is freed.
+    inline void freeAlloc(const void *ptr);
+
+    /// Start sampling allocations.
+    /// \param samplingInterval The mean number of bytes between samples.
+    /// \param seed If non-negative, seed for the random number generator
+    ///   used to pick samples, to make the sampling reproducible.
+    void enable(size_t samplingInterval, int64_t seed);
+
+    /// Stop sampling allocations, write out a profile of the sampled
+    /// allocations which are still alive, and drop all samples.
+    /// The profile is written to \p os in the format used by the Chrome
+    /// DevTools "Allocation sampling" profiler (a .heapprofile file), with
+    /// call-frames taken from \p stackTracesTree.
+    void disable(llvm::raw_ostream &os, const StackTracesTree *stackTracesTree);
+
+   private:
+    /// Data recorded for every sampled allocation.
+    struct Sample {
+      /// Size of the allocation in bytes.
+      uint32_t size;
+      /// Stack-trace at the point of allocation.
+      StackTracesTreeNode *node;
+      /// Unique, increasing ID of the sample, used to order samples.
+      uint64_t id;
+    };
+
+    /// Slow path of \c newAlloc(), taken when the sampling threshold is
+    /// crossed. Records the current stack-trace for \p ptr and picks the next
+    /// sampling point.
+    void sampleAlloc(const void *ptr, uint32_t sz);
+
+    /// \return the number of bytes to allocate before the next sample.
+    size_t nextSampleDistance();
+
+    /// Associates sampled allocations at their current location with their
+    /// sample data.
+    llvm::DenseMap<const void *, Sample> samples_;
+    /// We need access to the GCBase to collect the current stack when samples
+    /// are taken.
+    GCBase *gc_;
+    /// Random number engine used to pick the distance between samples.
+    std::mt19937_64 randomEngine_;
+    /// Distribution of the distance in bytes between two samples. The mean is
+    /// the sampling interval.
+    std::exponential_distribution<double> dist_;
+    /// Number of bytes which may still be allocated before a sample is taken.
+    size_t bytesUntilSample_{0};
+    /// ID to give the next sample.
+    uint64_t nextSampleID_{1};
+    /// Indicates if sampling of new allocations is enabled.
+    bool enabled_{false};
+  };
+
   class IDTracker final {
    public:
     /// These are IDs that are reserved for special objects.
@@ -682,6 +759,25 @@ class GCBase {
   void creditExternalMemory(GCCell *alloc, uint32_t size) {}
   void debitExternalMemory(GCCell *alloc, uint32_t size) {}
 
+  /// Called by finalizers to release native resources which are not shared
+  /// with anything else in the VM (e.g. a malloc'ed buffer): calls
+  /// \p release on \p context, either right away, or, if background
+  /// finalization is enabled, on the background finalizer thread after the
+  /// current collection.
+  void releaseNative(BackgroundFinalizer::ReleaseFunc release, void *context) {
+    if (backgroundFinalizer_) {
+      backgroundFinalizer_->add(release, context);
+    } else {
+      release(context);
+    }
+  }
+
+  /// \return the background finalizer, or null if background finalization is
+  /// disabled.
+  BackgroundFinalizer *getBackgroundFinalizer() {
+    return backgroundFinalizer_.get();
+  }
+
   /// Default implementations for read and write barriers: do nothing.
   inline void writeBarrier(void *loc, HermesValue value) {}
   inline void writeBarrier(void *loc, void *value) {}
@@ -745,13 +841,6 @@ class GCBase {
 
   /// Utilities for WeakMap marking.
 
-  /// \return a list of pointers to all the WeakRefKeys in \p weakMap.
-  /// The \p gc argument is passed to methods that verify they're only
-  /// called during GC.
-  static std::list<detail::WeakRefKey *> buildKeyList(
-      GC *gc,
-      JSWeakMap *weakMap);
-
   /// For all non-null keys in \p weakMap that are unreachable, clear
   /// the key (clear the pointer in the WeakRefSlot) and value (set it
   /// to undefined).
@@ -761,43 +850,6 @@ class GCBase {
       JSWeakMap *weakMap,
       KeyReachableFunc keyReachable);
 
-  /// For all reachable keys in \p weakMap, mark from the
-  /// corresponding value using the given \p acceptor, reaching a
-  /// transitive closure.  The acceptor is required to have a property
-  /// we don't normally require: it must be idempotent.  I.e., it must
-  /// function properly when applied multiple times to the same
-  /// pointer slot during a collection.  "Mark-in-place" acceptors
-  /// will generally have this property.  Uses \p objIsMarked to
-  /// determine whether an object is marked, and, for entries whose
-  /// keys are marked, invokes \p checkValIsMarked on the
-  /// corresponding value.  These have the following specs:
-  ///
-  ///  * objIsMarked: (GCCell*) ==> bool
-  ///    Returns whether a GCCell is marked.
-  ///
-  ///  * markFromVal: GCCell *cell, GCHermesValue &cellRef) ==> bool
-  ///    If the argument is unmarked, mark it, schedule for scanning.
-  ///    Returns whether the object was newly marked.
-  ///
-  /// If the \p unreachableKeys map has an entry for \p weakMap, assumes the
-  /// list of WeakRefKeys contains all possibly-unreachable keys; any
-  /// other keys are assumed to have already been found reachable.
-  /// Ensures that \p unreachableKeys has an accurate value for \p
-  /// weakMap before return.  \return whether any previously-unmarked
-  /// values were marked.
-  template <
-      typename Acceptor,
-      typename ObjIsMarkedFunc,
-      typename MarkFromValFunc>
-  static bool markFromReachableWeakMapKeys(
-      GC *gc,
-      JSWeakMap *weakMap,
-      Acceptor &acceptor,
-      llvm::DenseMap<JSWeakMap *, std::list<detail::WeakRefKey *>>
-          *unreachableKeys,
-      ObjIsMarkedFunc objIsMarked,
-      MarkFromValFunc markFromVal);
-
   /// \return A reference to the mutex that controls accessing any WeakRef.
   ///   This mutex must be held if a WeakRef is created or modified.
   WeakRefMutex &weakRefMutex();
@@ -806,13 +858,14 @@ class GCBase {
   /// \p reachableWeakMaps.  For all these WeakMaps, find all
   /// reachable keys and mark from the corresponding value using the given \p
   /// acceptor, reaching a transitive closure.
-  /// Do this until no newly reachable objects are found in a
-  /// traversal of the WeakMaps.  We assume that WeakMaps found newly
-  /// reachable are added to \p reachableWeakMaps, and do not assume
-  /// we've reached transitive closure until all maps are scanned.
+  /// Each WeakMap is scanned once; entries whose keys are not marked yet are
+  /// recorded in \p ephemerons, and their values are marked when the
+  /// collector reports through \p ephemerons that it marked their keys.  The
+  /// collector must report every cell it marks until this returns.  WeakMaps
+  /// found newly reachable are expected to be added to \p reachableWeakMaps.
   /// Uses \p objIsMarked to determine whether an object is marked,
   /// and, for entries whose keys are marked, invokes \p
-  /// checkValIsMarked on the corresponding value.  Used \p
+  /// markFromVal on the corresponding value.  Uses \p
   /// drainMarkStack to ensure that the transitive closure of what's
   /// currently on the mark stack is marked.  Requires \p acceptor
   /// to be idempotent: it must be legal to apply the acceptor
@@ -849,6 +902,7 @@ class GCBase {
       GC *gc,
       Acceptor &acceptor,
       std::vector<JSWeakMap *> &reachableWeakMaps,
+      WeakMapEphemeronTable &ephemerons,
       ObjIsMarkedFunc objIsMarked,
       MarkFromValFunc markFromVal,
       DrainMarkStackFunc drainMarkStack,
@@ -868,6 +922,10 @@ class GCBase {
     return allocationLocationTracker_;
   }
 
+  SamplingAllocationLocationTracker &getSamplingAllocationTracker() {
+    return samplingAllocationTracker_;
+  }
+
   inline HeapSnapshot::NodeID getObjectID(const void *cell);
   inline HeapSnapshot::NodeID getObjectID(const GCPointerBase &cell);
   inline HeapSnapshot::NodeID getObjectID(const SymbolID &sym);
@@ -962,6 +1020,13 @@ class GCBase {
   /// comma (anticipating more objects added after it).
   virtual void printStats(llvm::raw_ostream &os, bool trailingComma);
 
+  /// Print how much of the storage of \p provider is backed by huge pages,
+  /// as fields of the collector-specific stats, each followed by a comma.
+  /// Prints nothing if \p provider doesn't use huge pages.
+  static void printHugePageStats(
+      llvm::raw_ostream &os,
+      const StorageProvider &provider);
+
   /// Record statistics from a single GC, which took \p wallTime seconds wall
   /// time and \p cpuTime seconds CPU time to run the gc and left the heap size
   /// at the given \p finalHeapSize, in the given cumulative stats struct.
@@ -1086,6 +1151,10 @@ class GCBase {
   /// Whether or not a GC cycle is currently occurring.
   bool inGC_;
 
+  /// Runs the native releases of finalizers off the mutator thread, if
+  /// background finalization is enabled.
+  std::unique_ptr<BackgroundFinalizer> backgroundFinalizer_;
+
   /// The block of fields below records values of various metrics at
   /// the start of execution, so that we can get the values at the end
   /// and subtract.  The "runtimeWillExecute" method is called at
@@ -1124,6 +1193,9 @@ class GCBase {
   /// Attaches stack-traces to objects when enabled.
   AllocationLocationTracker allocationLocationTracker_;
 
+  /// Attaches stack-traces to a sample of objects when enabled.
+  SamplingAllocationLocationTracker samplingAllocationTracker_;
+
 #ifndef NDEBUG
   /// The number of reasons why no allocation is allowed in this heap right
   /// now.
@@ -1587,12 +1659,16 @@ inline bool GCBase::AllocationLocationTracker::isEnabled() const {
 }
 
 inline void GCBase::AllocationLocationTracker::newAlloc(const void *ptr) {
-  // Note we always get the current IP even if allocation tracking is not
-  // enabled as it allows us to assert this feature works across many tests.
-  // Note it's not very slow, it's slower than the non-virtual version
-  // in Runtime though.
-  const auto *ip = gc_->gcCallbacks_->getCurrentIPSlow();
+#ifndef NDEBUG
+  // Note we always get the current IP in debug builds even if allocation
+  // tracking is not enabled as it allows us to assert this feature works
+  // across many tests. Note it's not very slow, it's slower than the
+  // non-virtual version in Runtime though. Release builds skip it so that
+  // having the feature compiled in costs nothing when it is disabled.
+  (void)gc_->gcCallbacks_->getCurrentIPSlow();
+#endif
   if (enabled_) {
+    const auto *ip = gc_->gcCallbacks_->getCurrentIPSlow();
     if (auto node = gc_->gcCallbacks_->getCurrentStackTracesTreeNode(ip)) {
       stackMap_.try_emplace(ptr, node);
     }
@@ -1637,6 +1713,59 @@ inline void GCBase::AllocationLocationTracker::disable() {
   enabled_ = false;
 }
 
+inline bool GCBase::AllocationLocationTracker::hasStackTraces() const {
+  return !stackMap_.empty();
+}
+
+inline void GCBase::AllocationLocationTracker::clear() {
+  stackMap_.clear();
+}
+
+GCBase::SamplingAllocationLocationTracker::SamplingAllocationLocationTracker(
+    GCBase *gc)
+    : gc_(gc) {}
+
+inline bool GCBase::SamplingAllocationLocationTracker::isEnabled() const {
+  return enabled_;
+}
+
+inline void GCBase::SamplingAllocationLocationTracker::newAlloc(
+    const void *ptr,
+    uint32_t sz) {
+  if (LLVM_LIKELY(!enabled_)) {
+    return;
+  }
+  if (LLVM_LIKELY(sz < bytesUntilSample_)) {
+    bytesUntilSample_ -= sz;
+    return;
+  }
+  sampleAlloc(ptr, sz);
+}
+
+inline void GCBase::SamplingAllocationLocationTracker::moveAlloc(
+    const void *oldPtr,
+    const void *newPtr) {
+  if (oldPtr == newPtr) {
+    // This can happen in old generations when compacting to the same location.
+    return;
+  }
+  auto oldIt = samples_.find(oldPtr);
+  if (oldIt == samples_.end()) {
+    return;
+  }
+  const Sample sample = oldIt->second;
+  assert(
+      samples_.count(newPtr) == 0 &&
+      "Moving to a location that is already sampled");
+  samples_.erase(oldIt);
+  samples_[newPtr] = sample;
+}
+
+inline void GCBase::SamplingAllocationLocationTracker::freeAlloc(
+    const void *ptr) {
+  samples_.erase(ptr);
+}
+
 } // namespace vm
 } // namespace hermes
 
@@ -899,6 +899,8 @@ class GenGC final : public GCBase {
   /// Cumulative by-phase times for full collection.
   double markRootsSecs_ = 0.0;
   double markTransitiveSecs_ = 0.0;
+  /// The part of markTransitiveSecs_ spent marking from WeakMap entries.
+  double weakMapMarkSecs_ = 0.0;
   double sweepSecs_ = 0.0;
   double updateReferencesSecs_ = 0.0;
   double compactSecs_ = 0.0;
@@ -951,6 +953,7 @@ inline void *GenGC::alloc(uint32_t sz) {
 #endif
 #ifdef HERMES_ENABLE_ALLOCATION_LOCATION_TRACES
   getAllocationLocationTracker().newAlloc(ptr);
+  getSamplingAllocationTracker().newAlloc(ptr, sz);
 #endif
   return ptr;
 }
@@ -1011,6 +1014,7 @@ inline void *GenGC::allocLongLived(uint32_t size) {
 #endif
 #ifdef HERMES_ENABLE_ALLOCATION_LOCATION_TRACES
   getAllocationLocationTracker().newAlloc(ptr);
+  getSamplingAllocationTracker().newAlloc(ptr, size);
 #endif
   return ptr;
 }
@@ -215,6 +215,9 @@ class HadesGC final : public GCBase {
   /// towards whether an object is live or dead.
   std::deque<WeakRefSlot> weakPointers_;
 
+  /// Cumulative time spent marking from WeakMap entries in OG collections.
+  double weakMapMarkSecs_{0.0};
+
   /// The main entrypoint for all allocations.
   /// \param sz The size of allocation requested. This might be rounded up to
   ///   fit heap alignment requirements.
@@ -48,6 +48,14 @@ struct ClassFlags {
   /// hidden class is never added to an inline cache.
   uint8_t dictionaryNoCacheMode : 1;
 
+  /// If dictionaryMode is set, this indicates that the hidden class must stay
+  /// usable as the key in inline caches, because the owning object is accessed
+  /// from many sites (the global object). Deleting or updating a property
+  /// never mutates such a class in place and never enters
+  /// dictionaryNoCacheMode: the owning object gets a new class with this flag,
+  /// which invalidates all inline caches referencing the old one.
+  uint8_t dictionaryAlwaysCacheable : 1;
+
   /// Set when we have index-like named properties (e.g. "0", "1", etc) defined
   /// using defineOwnProperty. Array accesses will have to check the named
   /// properties first. The absence of this flag is important as it indicates
@@ -318,6 +326,19 @@ class HiddenClass final : public GCCell {
     return flags_.dictionaryNoCacheMode;
   }
 
+  /// \return true if this class is a dictionary which stays cacheable when
+  /// properties are deleted or updated, see ClassFlags.
+  bool isDictionaryAlwaysCacheable() const {
+    return flags_.dictionaryAlwaysCacheable;
+  }
+
+  /// \return true if this class can be the key of a write inline cache entry.
+  /// Dictionaries only qualify if they are always cacheable, since the flags
+  /// of their existing properties are then never changed in place.
+  bool isWriteCacheable() const {
+    return !isDictionary() || isDictionaryAlwaysCacheable();
+  }
+
   bool getHasIndexLikeProperties() const {
     return flags_.hasIndexLikeProperties;
   }
@@ -450,11 +471,20 @@ class HiddenClass final : public GCCell {
       Handle<HiddenClass> selfHandle,
       Runtime *runtime);
 
+  /// Create a copy of the class \p selfHandle in dictionary mode, with the
+  /// dictionaryAlwaysCacheable flag set. The class must not be in no-cache
+  /// mode.
+  /// \return the new class.
+  static Handle<HiddenClass> copyToAlwaysCacheableDictionary(
+      Handle<HiddenClass> selfHandle,
+      Runtime *runtime);
+
   /// Update the flags for the properties in the list \p props with \p
-  /// flagsToClear and \p flagsToSet. If in dictionary mode, the properties are
-  /// updated on the hidden class directly; otherwise, create a new dictionary
-  /// hidden class as result. Updating the properties mutates the property map
-  /// directly without creating transitions.
+  /// flagsToClear and \p flagsToSet. If in dictionary mode (and not always
+  /// cacheable), the properties are updated on the hidden class directly;
+  /// otherwise, create a new dictionary hidden class as result. Updating the
+  /// properties mutates the property map directly without creating
+  /// transitions.
   /// \p flagsToClear and \p flagsToSet are masks for updating the property
   /// flags.
   /// \p props is a list of SymbolIDs for properties that need to be updated
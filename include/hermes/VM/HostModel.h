@@ -64,12 +64,14 @@ class FinalizableNativeFunction final : public NativeFunction {
             functionPtr),
         finalizePtr_(finalizePtr) {}
 
-  ~FinalizableNativeFunction() {
-    finalizePtr_(context_);
-  }
+  /// The context is released by _finalizeImpl.
+  ~FinalizableNativeFunction() = default;
 
-  static void _finalizeImpl(GCCell *cell, GC *) {
+  static void _finalizeImpl(GCCell *cell, GC *gc) {
     auto *self = vmcast<FinalizableNativeFunction>(cell);
+    // The context belongs to the embedder, which may release it on any
+    // thread.
+    gc->releaseNative(self->finalizePtr_, self->context_);
     // Destruct the object.
     self->~FinalizableNativeFunction();
   }
@@ -135,6 +137,8 @@ class HostObject final : public DecoratedObject {
       HiddenClass *clazz,
       std::unique_ptr<HostObjectProxy> proxy)
       : DecoratedObject(runtime, &vt, parent, clazz, std::move(proxy)) {}
+
+  static void _finalizeImpl(GCCell *cell, GC *gc);
 };
 
 } // namespace vm
@@ -80,7 +80,7 @@ class IdentifierTable {
   CallResult<Handle<SymbolID>>
   getSymbolHandle(Runtime *runtime, UTF16Ref str, uint32_t hash);
   CallResult<Handle<SymbolID>> getSymbolHandle(Runtime *runtime, UTF16Ref str) {
-    return getSymbolHandle(runtime, str, hermes::hashString(str));
+    return getSymbolHandle(runtime, str, hermes::runtimeHashString(str));
   }
 
   /// Given a ASCII string \p str, retrieve a unique SymbolID for that
@@ -88,7 +88,7 @@ class IdentifierTable {
   CallResult<Handle<SymbolID>>
   getSymbolHandle(Runtime *runtime, ASCIIRef str, uint32_t hash);
   CallResult<Handle<SymbolID>> getSymbolHandle(Runtime *runtime, ASCIIRef str) {
-    return getSymbolHandle(runtime, str, hermes::hashString(str));
+    return getSymbolHandle(runtime, str, hermes::runtimeHashString(str));
   }
 
   /// Given a UTF16 string \p str, if an equal string is already in the table,
@@ -235,7 +235,7 @@ class IdentifierTable {
           isUTF16_(false),
           isNotUniqued_(isNotUniqued),
           num_(str.size()),
-          hash_(hermes::hashString(str)) {}
+          hash_(hermes::runtimeHashString(str)) {}
     explicit LookupEntry(ASCIIRef str, uint32_t hash, bool isNotUniqued = false)
         : asciiPtr_(str.data()),
           isUTF16_(false),
@@ -247,7 +247,7 @@ class IdentifierTable {
           isUTF16_(true),
           isNotUniqued_(false),
           num_(str.size()),
-          hash_(hermes::hashString(str)) {}
+          hash_(hermes::runtimeHashString(str)) {}
     explicit LookupEntry(UTF16Ref str, uint32_t hash)
         : utf16Ptr_(str.data()),
           isUTF16_(true),
@@ -411,7 +411,7 @@ class IdentifierTable {
       llvm::ArrayRef<T> str,
       Handle<StringPrimitive> primHandle) {
     return getOrCreateIdentifier(
-        runtime, str, primHandle, hermes::hashString(str));
+        runtime, str, primHandle, hermes::runtimeHashString(str));
   }
 
   /// Internal implementation of registerLazyIdentifier().
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_VM_INTERPRETER_INLINE_H
+#define HERMES_VM_INTERPRETER_INLINE_H
+
+#include "hermes/VM/Interpreter.h"
+#include "hermes/VM/JSArray.h"
+#include "hermes/VM/JSTypedArray.h"
+#include "hermes/VM/Operations.h"
+
+namespace hermes {
+namespace vm {
+
+namespace detail {
+
+/// \return the element \p index of the typed array \p base, or Empty if it is
+///   out of bounds or the buffer is detached.
+template <typename T, CellKind C>
+inline HermesValue
+getTypedArrayElementFast(Runtime *runtime, JSObject *base, uint32_t index) {
+  auto *self = vmcast<JSTypedArray<T, C>>(base);
+  if (LLVM_LIKELY(index < self->getLength() && self->attached(runtime)))
+    return SafeNumericEncoder<T>::encode(self->at(runtime, index));
+  return HermesValue::encodeEmptyValue();
+}
+
+/// Store \p value in the element \p index of the typed array \p base.
+/// \return false if it is out of bounds or the buffer is detached.
+template <typename T, CellKind C>
+inline bool putTypedArrayElementFast(
+    Runtime *runtime,
+    JSObject *base,
+    uint32_t index,
+    double value) {
+  auto *self = vmcast<JSTypedArray<T, C>>(base);
+  if (LLVM_UNLIKELY(index >= self->getLength() || !self->attached(runtime)))
+    return false;
+  self->at(runtime, index) = JSTypedArray<T, C>::toDestType(value);
+  return true;
+}
+
+} // namespace detail
+
+inline JSObject *Interpreter::getCachedPrototypeHolder(
+    Runtime *runtime,
+    JSObject *obj,
+    SymbolID id,
+    PropertyCacheEntry *cacheEntry) {
+  // A lazy object is reported as having no properties, see the TODO in
+  // CASE(GetById).
+  if (LLVM_UNLIKELY(obj->isLazy() || obj->isHostObject()))
+    return nullptr;
+
+  JSObject *holder = obj->getParent(runtime);
+  for (uint32_t depth = cacheEntry->protoDepth; holder && depth > 1; --depth) {
+    if (LLVM_UNLIKELY(
+            holder->isLazy() || holder->isHostObject() ||
+            holder->isProxyObject()))
+      return nullptr;
+    // The cached class only tells us where the holder keeps the property, so
+    // every prototype before it must be checked for a shadowing property.
+    NamedPropertyDescriptor desc;
+    OptValue<bool> found =
+        JSObject::tryGetOwnNamedDescriptorFast(holder, runtime, id, desc);
+    if (!found.hasValue() || found.getValue())
+      return nullptr;
+    holder = holder->getParent(runtime);
+  }
+
+  if (holder && cacheEntry->clazz == holder->getClassGCPtr().getStorageType())
+    return holder;
+  return nullptr;
+}
+
+inline HermesValue Interpreter::getByValObjectFast(
+    Runtime *runtime,
+    JSObject *base,
+    HermesValue name) {
+  auto index = toArrayIndexFastPath(name);
+  if (!index)
+    return HermesValue::encodeEmptyValue();
+  return getByIndexObjectFast(runtime, base, *index);
+}
+
+inline HermesValue Interpreter::getByIndexObjectFast(
+    Runtime *runtime,
+    JSObject *base,
+    uint32_t index) {
+  if (LLVM_UNLIKELY(!base->hasFastIndexProperties()))
+    return HermesValue::encodeEmptyValue();
+
+  switch (base->getKind()) {
+    case CellKind::ArrayKind:
+      // A hole is returned as Empty, and looked up in the prototype chain
+      // by the caller.
+      return vmcast<JSArray>(base)->at(runtime, index);
+#define TYPED_ARRAY(name, type)                           \
+  case CellKind::name##ArrayKind:                         \
+    return detail::getTypedArrayElementFast<              \
+        type,                                             \
+        CellKind::name##ArrayKind>(runtime, base, index);
+#include "hermes/VM/TypedArrays.def"
+    default:
+      return HermesValue::encodeEmptyValue();
+  }
+}
+
+inline bool Interpreter::putByValObjectFast(
+    Runtime *runtime,
+    JSObject *base,
+    HermesValue name,
+    HermesValue value) {
+  auto index = toArrayIndexFastPath(name);
+  if (!index)
+    return false;
+  return putByIndexObjectFast(runtime, base, *index, value);
+}
+
+inline bool Interpreter::putByIndexObjectFast(
+    Runtime *runtime,
+    JSObject *base,
+    uint32_t index,
+    HermesValue value) {
+  if (LLVM_UNLIKELY(!base->hasFastIndexProperties()))
+    return false;
+
+  switch (base->getKind()) {
+    case CellKind::ArrayKind:
+      return vmcast<JSArray>(base)->trySetExistingElementAt(
+          runtime, index, value);
+#define TYPED_ARRAY(name, type)                            \
+  case CellKind::name##ArrayKind:                          \
+    return value.isNumber() &&                             \
+        detail::putTypedArrayElementFast<                  \
+               type,                                       \
+               CellKind::name##ArrayKind>(                 \
+               runtime, base, index, value.getNumber());
+#include "hermes/VM/TypedArrays.def"
+    default:
+      return false;
+  }
+}
+
+} // namespace vm
+} // namespace hermes
+
+#endif // HERMES_VM_INTERPRETER_INLINE_H
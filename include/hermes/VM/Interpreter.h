@@ -99,6 +99,18 @@ class Interpreter {
   static PseudoHandle<>
   tryGetPrimitiveOwnPropertyById(Runtime *runtime, Handle<> base, SymbolID id);
 
+  /// Fast path for OpCode::GetById when the property \p id is definitely not
+  /// an own property of \p obj: walk the prototype chain of \p obj as far as
+  /// recorded in \p cacheEntry, checking that the prototypes in between still
+  /// don't have the property.
+  /// \return the prototype holding the property in \c cacheEntry->slot, or
+  ///   nullptr if the cache entry doesn't apply to \p obj.
+  static inline JSObject *getCachedPrototypeHolder(
+      Runtime *runtime,
+      JSObject *obj,
+      SymbolID id,
+      PropertyCacheEntry *cacheEntry);
+
   /// Implement OpCode::GetById/TryGetById when the base is not an object.
   static CallResult<PseudoHandle<>>
   getByIdTransient_RJS(Runtime *runtime, Handle<> base, SymbolID id);
@@ -109,6 +121,39 @@ class Interpreter {
   static PseudoHandle<>
   getByValTransientFast(Runtime *runtime, Handle<> base, Handle<> nameHandle);
 
+  /// Fast path for OpCode::GetByVal when \p base is an object: if it is an
+  /// array or a typed array and \p name is an index within its bounds, load
+  /// the element directly from its storage.
+  /// \return the element, or Empty if the general path must be taken (the
+  ///   element is a hole, out of bounds, or \p name is not an index).
+  static inline HermesValue
+  getByValObjectFast(Runtime *runtime, JSObject *base, HermesValue name);
+
+  /// Same as getByValObjectFast(), for a name which is already known to be
+  /// the array index \p index.
+  static inline HermesValue
+  getByIndexObjectFast(Runtime *runtime, JSObject *base, uint32_t index);
+
+  /// Fast path for OpCode::PutByVal when \p base is an object: if it is an
+  /// array whose element \p name already exists, or a typed array with \p name
+  /// in bounds and \p value a number, store \p value directly into its
+  /// storage.
+  /// \return true if \p value was stored, false if the general path must be
+  ///   taken.
+  static inline bool putByValObjectFast(
+      Runtime *runtime,
+      JSObject *base,
+      HermesValue name,
+      HermesValue value);
+
+  /// Same as putByValObjectFast(), for a name which is already known to be
+  /// the array index \p index.
+  static inline bool putByIndexObjectFast(
+      Runtime *runtime,
+      JSObject *base,
+      uint32_t index,
+      HermesValue value);
+
   /// Implement OpCode::GetByVal when the base is not an object.
   static CallResult<PseudoHandle<>>
   getByValTransient_RJS(Runtime *runtime, Handle<> base, Handle<> name);
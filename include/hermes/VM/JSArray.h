@@ -87,6 +87,26 @@ class ArrayImpl : public JSObject {
         .set(value, &runtime->getHeap());
   }
 
+  /// Update the element at index \p index if it exists in storage and is not
+  /// empty, and the array is not frozen. Unlike setOwnIndexed(), this never
+  /// resizes the storage.
+  /// \return true if the element was updated, false if the caller must take
+  ///   the general path.
+  bool trySetExistingElementAt(
+      Runtime *runtime,
+      size_type index,
+      HermesValue value) {
+    if (LLVM_UNLIKELY(flags_.frozen) || index < beginIndex_ ||
+        index >= endIndex_)
+      return false;
+    auto &element =
+        indexedStorage_.getNonNull(runtime)->at(index - beginIndex_);
+    if (LLVM_UNLIKELY(element.isEmpty()))
+      return false;
+    element.set(value, &runtime->getHeap());
+    return true;
+  }
+
   /// Set the element at index \p index to empty. This does not affect the
   /// storage size or array length.
   /// \return true if the operation succeeded (which is always in this class).
@@ -61,19 +61,25 @@ class JSMapImpl final : public JSObject {
     return static_cast<bool>(storage_);
   }
 
-  /// Advance iterator and return the next.
-  HashMapEntry *iteratorNext(Runtime *runtime, HashMapEntry *entry) {
-    return storage_.get(runtime)->iteratorNext(runtime, entry);
+  /// Advance the iteration position \p pos, and store the key and value of
+  /// the next element into \p key and \p value.
+  /// \return false if there are no more elements.
+  bool iteratorNext(
+      Runtime *runtime,
+      OrderedHashMap::IterationPosition &pos,
+      MutableHandle<> &key,
+      MutableHandle<> &value) {
+    return storage_.get(runtime)->iteratorNext(runtime, pos, key, value);
   }
 
   /// Add a value.
-  static void addValue(
+  static ExecutionStatus addValue(
       Handle<JSMapImpl> self,
       Runtime *runtime,
       Handle<> key,
       Handle<> value) {
     self->assertInitialized();
-    OrderedHashMap::insert(
+    return OrderedHashMap::insert(
         runtime->makeHandle<OrderedHashMap>(self->storage_),
         runtime,
         key,
@@ -111,7 +117,8 @@ class JSMapImpl final : public JSObject {
   /// Clear all elements from the storage.
   static void clear(Handle<JSMapImpl> self, Runtime *runtime) {
     self->assertInitialized();
-    self->storage_.get(runtime)->clear(runtime);
+    OrderedHashMap::clear(
+        runtime->makeHandle<OrderedHashMap>(self->storage_), runtime);
   }
 
   /// Call \p callbackfn for each entry, with \p thisArg as this.
@@ -121,23 +128,21 @@ class JSMapImpl final : public JSObject {
       Handle<Callable> callbackfn,
       Handle<> thisArg) {
     self->assertInitialized();
-    MutableHandle<HashMapEntry> entry{runtime};
+    OrderedHashMap::IterationPosition pos{};
+    MutableHandle<> key{runtime};
+    MutableHandle<> value{runtime};
     GCScopeMarkerRAII marker{runtime};
-    for (entry = self->storage_.get(runtime)->iteratorNext(runtime); entry;
-         entry =
-             self->storage_.get(runtime)->iteratorNext(runtime, entry.get())) {
+    while (self->iteratorNext(runtime, pos, key, value)) {
       marker.flush();
-      HermesValue key = entry->key;
-      HermesValue value = entry->value;
-      assert(!key.isEmpty() && "Invalid key encountered");
-      assert(!value.isEmpty() && "Invalid value encountered");
+      assert(!key->isEmpty() && "Invalid key encountered");
+      assert(!value->isEmpty() && "Invalid value encountered");
       if (LLVM_UNLIKELY(
               Callable::executeCall3(
                   callbackfn,
                   runtime,
                   thisArg,
-                  value,
-                  key,
+                  value.get(),
+                  key.get(),
                   self.getHermesValue()) == ExecutionStatus::EXCEPTION)) {
         return ExecutionStatus::EXCEPTION;
       }
@@ -217,18 +222,16 @@ class JSMapIteratorImpl final : public JSObject {
       // Iteration has not yet reached the end previously.
       assert(self->data_ && "Storage uninitialized");
       // Advance the iterator.
-      self->itr_.set(
-          runtime,
-          self->data_.get(runtime)->iteratorNext(
-              runtime, self->itr_.get(runtime)),
-          &runtime->getHeap());
-      if (self->itr_) {
+      MutableHandle<> entryKey{runtime};
+      MutableHandle<> entryValue{runtime};
+      if (self->data_.get(runtime)->iteratorNext(
+              runtime, self->pos_, entryKey, entryValue)) {
         switch (self->iterationKind_) {
           case IterationKind::Key:
-            value = self->itr_.get(runtime)->key;
+            value = entryKey.get();
             break;
           case IterationKind::Value:
-            value = self->itr_.get(runtime)->value;
+            value = entryValue.get();
             break;
           case IterationKind::Entry: {
             // If we are iterating both key and value, we need to create an
@@ -238,10 +241,8 @@ class JSMapIteratorImpl final : public JSObject {
               return ExecutionStatus::EXCEPTION;
             }
             auto arrHandle = runtime->makeHandle(std::move(*arrRes));
-            value = self->itr_.get(runtime)->key;
-            JSArray::setElementAt(arrHandle, runtime, 0, value);
-            value = self->itr_.get(runtime)->value;
-            JSArray::setElementAt(arrHandle, runtime, 1, value);
+            JSArray::setElementAt(arrHandle, runtime, 0, entryKey);
+            JSArray::setElementAt(arrHandle, runtime, 1, entryValue);
             value = arrHandle.getHermesValue();
             break;
           };
@@ -283,8 +284,8 @@ class JSMapIteratorImpl final : public JSObject {
   /// initialized or the iteration has ended.
   GCPointer<JSMapImpl<JSMapTypeTraits<C>::ContainerKind>> data_{nullptr};
 
-  /// Iteration pointer to the element storage in the Map.
-  GCPointer<HashMapEntry> itr_{nullptr};
+  /// The position of the iteration in the Map.
+  OrderedHashMap::IterationPosition pos_{};
 
   IterationKind iterationKind_;
 
@@ -399,6 +399,14 @@ class JSObject : public GCCell {
       Runtime *runtime,
       unsigned propertyCount);
 
+  /// Attempts to allocate a JSObject with the given prototype and property
+  /// storage preallocated. If allocation fails, the GC declares an OOM.
+  /// \param propertyCount number of property storage slots preallocated.
+  static PseudoHandle<JSObject> create(
+      Runtime *runtime,
+      Handle<JSObject> parentHandle,
+      unsigned propertyCount);
+
   /// Allocates a JSObject with the given hidden class and property storage
   /// preallocated. If allocation fails, the GC declares an
   /// OOM.
@@ -437,6 +445,12 @@ class JSObject : public GCCell {
     return flags_.proxyObject;
   }
 
+  /// \return true if all the index-like properties of this object are in its
+  ///   indexed storage.
+  bool hasFastIndexProperties() const {
+    return flags_.fastIndexProperties;
+  }
+
   /// \return the `__proto__` internal property, which may be nullptr.
   JSObject *getParent(Runtime *runtime) const {
     assert(
@@ -759,13 +773,17 @@ class JSObject : public GCCell {
   /// \param expectedFlags if valid, we are searching for a property which, if
   ///   not found, we would create with these specific flags. This can speed
   ///   up the search in the negative case - when the property doesn't exist.
+  /// \param[out] protoDepth if not null, and the property is found in the
+  ///   property storage of an object, the number of prototype links between
+  ///   this object and that one.
   /// \return the object instance containing the property, or nullptr.
   static JSObject *getNamedDescriptor(
       Handle<JSObject> selfHandle,
       Runtime *runtime,
       SymbolID name,
       PropertyFlags expectedFlags,
-      NamedPropertyDescriptor &desc);
+      NamedPropertyDescriptor &desc,
+      uint32_t *protoDepth = nullptr);
 
   /// ES5.1 8.12.2.
   /// Wrapper around \c getNamedDescriptor() passing \c false to \c
@@ -1092,6 +1110,14 @@ class JSObject : public GCCell {
       PropertyFlags flagsToSet,
       OptValue<llvm::ArrayRef<SymbolID>> props);
 
+  /// Move \p selfHandle to a dictionary hidden class which stays usable as an
+  /// inline cache key when its properties are deleted or updated, instead of
+  /// switching to no-cache mode. Intended for the global object, so that
+  /// accesses to globals stay cached no matter how many there are.
+  static void makeDictionaryAlwaysCacheable(
+      Handle<JSObject> selfHandle,
+      Runtime *runtime);
+
   /// First call \p indexedCB, passing each indexed property's \c uint32_t
   /// index and \c ComputedPropertyDescriptor. Then call \p namedCB passing each
   /// named property's \c SymbolID and \c  NamedPropertyDescriptor as
@@ -28,6 +28,10 @@ class LimitedStorageProvider final : public StorageProvider {
       size_t limit)
       : delegate_(std::move(provider)), limit_(limit) {}
 
+  llvm::Optional<size_t> hugePageBytes() const override {
+    return delegate_->hugePageBytes();
+  }
+
  protected:
   llvm::ErrorOr<void *> newStorageImpl(const char *name) override;
 
@@ -356,6 +356,7 @@ inline void *MallocGC::alloc(uint32_t size) {
 #endif
 #ifdef HERMES_ENABLE_ALLOCATION_LOCATION_TRACES
   getAllocationLocationTracker().newAlloc(mem);
+  getSamplingAllocationTracker().newAlloc(mem, size);
 #endif
   return mem;
 }
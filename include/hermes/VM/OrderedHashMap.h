@@ -9,7 +9,7 @@
 #define HERMES_VM_ORDERED_HASHMAP_H
 
 #include "hermes/Support/ErrorHandling.h"
-#include "hermes/VM/ArrayStorage.h"
+#include "hermes/VM/SegmentedArray.h"
 #include "hermes/VM/Runtime.h"
 
 #include <vector>
@@ -17,72 +17,28 @@
 namespace hermes {
 namespace vm {
 
-/// HashMapEntry is a gc-managed entry in the OrderedHashMap.
-/// We use HashMapEntry to form two separate linked lists,
-/// one that tracks the insertion order for iteration purpose, one
-/// tracks the list of entries in a hash table bucket for hash operations.
-class HashMapEntry final : public GCCell {
- public:
-  static VTable vt;
-
-  /// The key.
-  GCHermesValue key;
-
-  /// The value.
-  GCHermesValue value;
-
-  /// Previous entry in insertion order.
-  GCPointer<HashMapEntry> prevIterationEntry{nullptr};
-
-  /// Next entry in insertion order.
-  GCPointer<HashMapEntry> nextIterationEntry{nullptr};
-
-  /// Next entry in the hash table bucket.
-  GCPointer<HashMapEntry> nextEntryInBucket{nullptr};
-
-  static bool classof(const GCCell *cell) {
-    return cell->getKind() == CellKind::HashMapEntryKind;
-  }
-
-  static CallResult<HermesValue> create(Runtime *runtime);
-
-  /// Indicates whether this entry has been deleted.
-  bool isDeleted() const {
-    assert(key.isEmpty() == value.isEmpty() && "Inconsistent deleted status");
-    return value.isEmpty();
-  }
-
-  /// Mark this entry as deleted.
-  void markDeleted(Runtime *runtime) {
-    key.setNonPtr(HermesValue::encodeEmptyValue(), &runtime->getHeap());
-    value.setNonPtr(HermesValue::encodeEmptyValue(), &runtime->getHeap());
-  }
-
- protected:
-#ifdef HERMESVM_SERIALIZE
-  explicit HashMapEntry(Deserializer &d);
-
-  friend void HashMapEntryDeserialize(Deserializer &d, CellKind kind);
-#endif
-
-  HashMapEntry(Runtime *runtime) : GCCell(&runtime->getHeap(), &vt) {}
-}; // HashMapEntry
-
 /// OrderedHashMap is a gc-managed hash map that maintains insertion order.
-/// The map contains two conceptual parts: a standard chained hash table,
-/// to store and lookup HermesValue; a linked list to maintain the insertion
-/// order.
-/// When an element is added, it's always appended to the end of the linked
-/// list. When an element is deleted, we mark it as deleted and remove it
-/// from the linked list, unless it's the last element.
-/// Iterators are pointers to the entries, which are always linked according
-/// to insertion order.
-/// When the size of the hash table becomes unreasonably large or small
-/// comparing to the number of alive elements, we will rehash the table.
-/// We always make sure that any entry at any moment can successfully find
-/// the next entry according to insertion order, and rely on GC to manage
-/// the "deleted" entries", free them when no more iterators are before
-/// that entry.
+/// It is a compact open-addressed table, stored in two SegmentedArrays instead
+/// of one cell per element:
+/// - The entries, in insertion order. Every entry takes ENTRY_SIZE slots:
+///   its key, its value and its sequence number, which counts the entries
+///   ever inserted into the map.
+/// - The hash table, with capacity_ slots which are either empty or hold the
+///   index of an entry as a native value. Collisions are resolved by
+///   triangular probing, which visits every slot of a power of 2 table.
+///
+/// When an element is added, it's always appended to the entries. When an
+/// element is deleted, its key and value are cleared but it stays in the
+/// entries, and its slot in the hash table stays occupied, so that probing
+/// continues past it. When the entries fill the hash table up to its load
+/// factor, or the map becomes sparse after deletions, the table is rebuilt,
+/// dropping the deleted entries.
+///
+/// Iterators remember the sequence number of the next entry to visit, which
+/// doesn't change when entries are added or removed, along with its index in
+/// the entries. Dropping deleted entries moves the other entries, so it bumps
+/// the epoch_ of the map, and iterators from an older epoch find their index
+/// again by binary search on the sequence numbers.
 class OrderedHashMap final : public GCCell {
   friend void OrderedHashMapBuildMeta(
       const GCCell *cell,
@@ -97,6 +53,18 @@ class OrderedHashMap final : public GCCell {
   friend void OrderedHashMapSerialize(Serializer &s, const GCCell *cell);
 #endif
 
+  /// A position in the insertion order of a map, which stays valid while
+  /// elements are added and removed.
+  struct IterationPosition {
+    /// Sequence number of the next entry to visit.
+    uint64_t seq{0};
+    /// Index of the next entry to visit, valid if the epoch of the map is
+    /// still epoch.
+    uint32_t index{0};
+    /// The epoch of the map when index was computed.
+    uint32_t epoch{0};
+  };
+
   static bool classof(const GCCell *cell) {
     return cell->getKind() == CellKind::OrderedHashMapKind;
   }
@@ -111,11 +79,6 @@ class OrderedHashMap final : public GCCell {
   static HermesValue
   get(Handle<OrderedHashMap> self, Runtime *runtime, Handle<> key);
 
-  /// Lookup \p key in the table and \return the value if exists.
-  /// Otherwise \return nullptr.
-  static HashMapEntry *
-  find(Handle<OrderedHashMap> self, Runtime *runtime, Handle<> key);
-
   /// Insert a key/value pair into the map, if not already existing.
   static ExecutionStatus insert(
       Handle<OrderedHashMap> self,
@@ -127,47 +90,56 @@ class OrderedHashMap final : public GCCell {
   static bool
   erase(Handle<OrderedHashMap> self, Runtime *runtime, Handle<> key);
 
-  /// Clear the map.  The \p gc parameter is necessary for write barriers.
-  void clear(Runtime *runtime);
+  /// Clear the map, and shrink it back to its initial capacity.
+  static void clear(Handle<OrderedHashMap> self, Runtime *runtime);
 
   /// \return the size of the map.
   uint32_t size() const {
     return size_;
   }
 
-  /// \return the next element in insertion order.
-  /// If \p entry is nullptr, we are starting the iteration from the first
-  /// entry that is not deleted.
-  /// Otherwise, we look for the next element after \p entry that is not
-  /// deleted.
-  HashMapEntry *iteratorNext(Runtime *runtime, HashMapEntry *entry = nullptr)
-      const;
+  /// Advance \p pos past the next element in insertion order which is not
+  /// deleted, and store its key and value into \p key and \p value.
+  /// \return false if there are no more elements.
+  bool iteratorNext(
+      Runtime *runtime,
+      IterationPosition &pos,
+      MutableHandle<> &key,
+      MutableHandle<> &value) const;
 
  protected:
-  OrderedHashMap(Runtime *runtime, Handle<ArrayStorage> hashTableStorage);
+  OrderedHashMap(
+      Runtime *runtime,
+      Handle<SegmentedArray> hashTableStorage,
+      Handle<SegmentedArray> entriesStorage);
 
  private:
-  /// The hashtable, with size always equal to capacity_. The number of
-  /// reachable entries from hashTable_ should be equal to size_.
-  GCPointer<ArrayStorage> hashTable_{nullptr};
+  /// The hashtable, with size always equal to capacity_. Every slot is
+  /// either empty or the index of an entry, as a native value.
+  GCPointer<SegmentedArray> hashTable_{nullptr};
 
-  /// The first entry ever inserted. We need this entry to begin an iteration.
-  GCPointer<HashMapEntry> firstIterationEntry_{nullptr};
+  /// The entries in insertion order, ENTRY_SIZE slots each.
+  GCPointer<SegmentedArray> entries_{nullptr};
 
-  /// The last entry inserted. We need it to add new elements afterwards.
-  GCPointer<HashMapEntry> lastIterationEntry_{nullptr};
+  /// Number of slots taken by an entry in entries_.
+  static constexpr uint32_t ENTRY_SIZE = 3;
+  /// Offsets of the parts of an entry.
+  static constexpr uint32_t KEY_OFFSET = 0;
+  static constexpr uint32_t VALUE_OFFSET = 1;
+  static constexpr uint32_t SEQ_OFFSET = 2;
 
   /// Initial capacity of the hash table.
   static constexpr uint32_t INITIAL_CAPACITY = 16;
 
-  /// Maximum capacity cannot exceed the maximum capacity of the underlying
-  /// ArrayStorage.
+  /// Maximum capacity, such that both the hash table and the entries it can
+  /// hold fit in a SegmentedArray.
   // It needs to be less than 1/4th the max 32-bit integer in order to use an
   // integer-based load factor check of 0.75.
   /// TODO(T31421960): Use constexpr std::min.
   static constexpr uint32_t MAX_CAPACITY =
-      ArrayStorage::maxElements() < UINT32_MAX / 4 ? ArrayStorage::maxElements()
-                                                   : UINT32_MAX / 4;
+      SegmentedArray::maxElements() / ENTRY_SIZE < UINT32_MAX / 4
+      ? SegmentedArray::maxElements() / ENTRY_SIZE
+      : UINT32_MAX / 4;
 
   /// Capacity of the hash table.
   uint32_t capacity_{INITIAL_CAPACITY};
@@ -175,29 +147,56 @@ class OrderedHashMap final : public GCCell {
   /// Number of alive entries in the storage.
   uint32_t size_{0};
 
-  /// Hash a HermesValue to an index to our hash table.
-  static uint32_t
-  hashToBucket(Handle<OrderedHashMap> self, Runtime *runtime, Handle<> key) {
-    auto hash = runtime->gcStableHashHermesValue(key);
-    assert(
-        (self->capacity_ & (self->capacity_ - 1)) == 0 &&
-        "capacity_ must be power of 2");
-    return hash & (self->capacity_ - 1);
+  /// Incremented whenever entries move to a different index.
+  uint32_t epoch_{0};
+
+  /// The sequence number of the next entry to be inserted. Sequence numbers
+  /// are stored in the entries as numbers, which are exact up to 2^53.
+  uint64_t nextSeq_{0};
+
+  /// \return the number of entries which the hash table can index with a
+  /// \p capacity, keeping the load factor at most 0.75.
+  static uint32_t usableEntries(uint32_t capacity) {
+    return capacity / 4 * 3;
   }
 
-  /// Remove a node from the linked list.
-  void removeLinkedListNode(Runtime *runtime, HashMapEntry *entry, GC *gc);
+  /// \return the number of entries, including the deleted ones.
+  uint32_t numEntries(Runtime *runtime) const {
+    return entries_.getNonNull(runtime)->size() / ENTRY_SIZE;
+  }
+
+  /// \return the key of the entry at \p index. Deleted entries have an empty
+  /// key.
+  HermesValue keyAt(Runtime *runtime, uint32_t index) const {
+    return entries_.getNonNull(runtime)->at(index * ENTRY_SIZE + KEY_OFFSET);
+  }
+
+  /// Hash a HermesValue.
+  static uint32_t hash(Runtime *runtime, Handle<> key) {
+    return runtime->gcStableHashHermesValue(key);
+  }
 
-  /// Lookup an entry with key as \p key in a given \p bucket.
-  HashMapEntry *
-  lookupInBucket(Runtime *runtime, uint32_t bucket, HermesValue key);
+  /// Look up \p key with hash \p hash.
+  /// \return the hash table slot which holds the index of its entry, or the
+  ///   empty slot where it would be inserted.
+  uint32_t lookup(Runtime *runtime, uint32_t hash, HermesValue key) const;
 
-  /// Adjust the capacity of the hashtable and rehash if necessary.
-  /// We make decisions based on the Load Factor (size / capacity).
-  /// Rehash if load factor is outside of the range of [0.25, 0.75].
-  static ExecutionStatus rehashIfNecessary(
+  /// Rebuild the hash table with \p newCapacity, dropping the deleted
+  /// entries if there are any.
+  static ExecutionStatus rebuild(
+      Handle<OrderedHashMap> self,
+      Runtime *runtime,
+      uint32_t newCapacity);
+
+  /// Replace the storage with the empty storage of a new map, giving back
+  /// the storage the map grew into. All the entries are dropped.
+  static ExecutionStatus resetStorage(
       Handle<OrderedHashMap> self,
       Runtime *runtime);
+
+  /// \return the smallest capacity which keeps the load factor of \p count
+  /// entries at most 0.5, or the maximum capacity.
+  static uint32_t capacityFor(uint32_t count);
 }; // OrderedHashMap
 } // namespace vm
 } // namespace hermes
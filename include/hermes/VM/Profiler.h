@@ -11,17 +11,84 @@
 #ifdef HERMESVM_PROFILER_OPCODE
 #include <x86intrin.h>
 
-#define INIT_OPCODE_PROFILER      \
-  uint64_t startTime = __rdtsc(); \
-  unsigned curOpcode = (unsigned)OpCode::Call;
+#include <cstdint>
 
-#define RECORD_OPCODE_START_TIME                \
-  curOpcode = (unsigned)ip->opCode;             \
-  runtime->opcodeExecuteFrequency[curOpcode]++; \
+namespace hermes {
+namespace vm {
+
+/// The opcode profiler attributes the cycles between two dispatches to the
+/// opcode (and CodeBlock) which was executing, so time spent in slow paths
+/// is included. Cycles spent in a nested interpreter invocation or in a native
+/// function are attributed to those instead, and must be excluded from the
+/// opcode which caused them (e.g. the Call that invoked a native function
+/// which in turn called back into JS). To support this, the Runtime keeps a
+/// running total of "excluded" cycles, and every timed region subtracts the
+/// growth of that total from its own duration.
+///
+/// This RAII class marks such a region: on destruction it adds the full
+/// duration of the region to the excluded total, replacing whatever nested
+/// regions added in the meantime so they aren't counted twice.
+class OpcodeProfilerExclusion {
+ public:
+  explicit OpcodeProfilerExclusion(uint64_t &excludedCycles)
+      : excludedCycles_(excludedCycles),
+        startExcludedCycles_(excludedCycles),
+        startTime_(__rdtsc()) {}
+
+  ~OpcodeProfilerExclusion() {
+    excludedCycles_ = startExcludedCycles_ + (__rdtsc() - startTime_);
+  }
+
+  /// \return the cycles spent in the region so far, not counting the cycles
+  /// of nested excluded regions.
+  uint64_t selfCycles() const {
+    return __rdtsc() - startTime_ - (excludedCycles_ - startExcludedCycles_);
+  }
+
+ private:
+  uint64_t &excludedCycles_;
+  const uint64_t startExcludedCycles_;
+  const uint64_t startTime_;
+};
+
+} // namespace vm
+} // namespace hermes
+
+#define INIT_OPCODE_PROFILER                                            \
+  OpcodeProfilerExclusion opcodeProfilerExclusion{                      \
+      runtime->opcodeProfilerExcludedCycles};                           \
+  uint64_t startTime = __rdtsc();                                       \
+  uint64_t startExcludedCycles = runtime->opcodeProfilerExcludedCycles; \
+  unsigned curOpcode = (unsigned)OpCode::Call;                          \
+  CodeBlock *profiledCodeBlock = nullptr;
+
+/// Start timing the opcode at \c ip. Pairs of opcodes are only counted
+/// when both execute in the same function, since a call or return can't be
+/// fused into a superinstruction.
+#define RECORD_OPCODE_START_TIME                                     \
+  if (profiledCodeBlock == curCodeBlock)                             \
+    runtime->opcodePairFrequency[curOpcode][(unsigned)ip->opCode]++; \
+  curOpcode = (unsigned)ip->opCode;                                  \
+  profiledCodeBlock = curCodeBlock;                                  \
+  runtime->opcodeExecuteFrequency[curOpcode]++;                      \
+  ++profiledCodeBlock->opcodeCount;                                  \
+  startExcludedCycles = runtime->opcodeProfilerExcludedCycles;       \
   startTime = __rdtsc();
 
-#define UPDATE_OPCODE_TIME_SPENT \
-  runtime->timeSpent[curOpcode] += __rdtsc() - startTime
+/// Attribute the cycles since the last update to the current opcode and
+/// CodeBlock, and restart the timer so the same cycles are never counted
+/// twice (e.g. on the exception path, which updates before dispatching).
+#define UPDATE_OPCODE_TIME_SPENT                                       \
+  do {                                                                 \
+    uint64_t now = __rdtsc();                                          \
+    uint64_t cycles = now - startTime -                                \
+        (runtime->opcodeProfilerExcludedCycles - startExcludedCycles); \
+    runtime->timeSpent[curOpcode] += cycles;                           \
+    if (profiledCodeBlock)                                             \
+      profiledCodeBlock->opcodeCycles += cycles;                       \
+    startExcludedCycles = runtime->opcodeProfilerExcludedCycles;       \
+    startTime = now;                                                   \
+  } while (0)
 
 #else
 
@@ -55,12 +55,22 @@ class InlineCacheProfiler {
       ++hitCount;
     }
 
+    /// Increment the count of misses served by the prototype chain cache.
+    void incrementProtoHit() {
+      ++protoHitCount;
+    }
+
     /// Total number of inline caching misses at the source location.
     uint64_t missCount{0};
 
     /// Total number of inline caching hits at the source location.
     uint64_t hitCount{0};
 
+    /// Number of the misses at the source location where the object's hidden
+    /// class didn't match, but the property was found through the cached
+    /// prototype chain without a full lookup.
+    uint64_t protoHitCount{0};
+
     /// Internal map that keeps track of the mapping between
     /// <property, object hidden class, cached hidden class> and its frequency.
     llvm::DenseMap<ICMissKey, uint64_t> hiddenClasses;
@@ -83,6 +93,10 @@ class InlineCacheProfiler {
   /// Record an inline caching hit.
   bool insertICHit(CodeBlock *codeblock, uint32_t instOffset);
 
+  /// Record an inline caching miss that was served by the prototype chain
+  /// cache. The miss itself must have been recorded with insertICMiss().
+  bool insertICProtoHit(CodeBlock *codeblock, uint32_t instOffset);
+
   /// Get the total number of inline caching misses.
   uint32_t getTotalMisses() {
     return totalMisses_;
@@ -159,6 +173,10 @@ class InlineCacheProfiler {
   /// Total number of inline caching hits during the program execution.
   uint64_t totalHits_{0};
 
+  /// Total number of inline caching misses served by the prototype chain
+  /// cache during the program execution.
+  uint64_t totalProtoHits_{0};
+
   /// Store the data structure of all inline caching misses information.
   /// The map is keyed by pairs <instruction offset, CodeBlock> and maps
   /// to ICMiss objects, which keeps track of hidden classes and frequency.
@@ -28,6 +28,11 @@ struct PropertyCacheEntry {
 
   /// Cached property index.
   SlotIndex slot{0};
+
+  /// Number of prototype links from the object the lookup started on to the
+  /// object of class \c clazz holding the property, or 0 if the property was
+  /// found on the object itself.
+  uint32_t protoDepth{0};
 };
 
 } // namespace vm
@@ -315,6 +315,15 @@ class Runtime : public HandleRootOwner,
   /// 256 characters are pre-allocated. The rest are allocated every time.
   Handle<StringPrimitive> getCharacterString(char16_t ch);
 
+  /// The number of non-negative integers whose string representation is
+  /// cached by getSmallIntString().
+  static constexpr uint32_t kNumSmallIntStrings = 1024;
+
+  /// Return the decimal StringPrimitive representation of \p n, which must be
+  /// less than kNumSmallIntStrings. Each one is allocated on first use and
+  /// then kept for the lifetime of the runtime.
+  Handle<StringPrimitive> getSmallIntString(uint32_t n);
+
   CodeBlock *getEmptyCodeBlock() const {
     assert(emptyCodeBlock_ && "Invalid empty code block");
     return emptyCodeBlock_;
@@ -670,8 +679,30 @@ class Runtime : public HandleRootOwner,
   /// Track time spent of each opcode in the interpreter, in CPU cycles.
   uint64_t timeSpent[256] = {0};
 
-  /// Dump opcode stats to a stream.
-  void dumpOpcodeStats(llvm::raw_ostream &os) const;
+  /// Track how often each opcode (second index) is executed immediately after
+  /// another one (first index) in the same function. This is the input for
+  /// choosing superinstructions.
+  uint32_t opcodePairFrequency[256][256] = {{0}};
+
+  /// Running total of cycles which must not be attributed to the opcodes
+  /// currently being timed. See \c OpcodeProfilerExclusion.
+  uint64_t opcodeProfilerExcludedCycles = 0;
+
+  /// Number of calls and cycles spent in a native function, excluding any JS
+  /// it called back into.
+  struct NativeCallProfile {
+    uint64_t count{0};
+    uint64_t cycles{0};
+  };
+
+  /// Native call profile, keyed by the C++ function pointer. We need to use
+  /// "void *" because DenseMapInfo uses alignOf() by default and that fails
+  /// with pointers to function.
+  llvm::DenseMap<void *, NativeCallProfile> nativeCallProfile{};
+
+  /// Dump opcode stats to a stream: time and frequency per opcode, time per
+  /// JS function and time per native function.
+  void dumpOpcodeStats(llvm::raw_ostream &os);
 #endif
 
 #if defined(HERMESVM_PROFILER_JSFUNCTION) || defined(HERMESVM_PROFILER_EXTERN)
@@ -805,6 +836,10 @@ class Runtime : public HandleRootOwner,
       HiddenClass *objectHiddenClass,
       HiddenClass *cachedHiddenClass);
 
+  /// Records in InlineCacheProfiler that the inline cache miss at
+  /// \p cacheMissInst was served by the prototype chain cache.
+  void recordPrototypeCacheHit(CodeBlock *codeBlock, const Inst *cacheMissInst);
+
   /// Resolve HiddenClass pointers from its hidden class Id.
   HiddenClass *resolveHiddenClassId(ClassId classId);
 
@@ -920,6 +955,10 @@ class Runtime : public HandleRootOwner,
   /// string for the passed character \p ch.
   Handle<StringPrimitive> allocateCharacterString(char16_t ch);
 
+  /// The slow path for \c getSmallIntString(). This function allocates the
+  /// string for \p n and stores it in \c smallIntStrings_.
+  Handle<StringPrimitive> allocateSmallIntString(uint32_t n);
+
   /// Add a \c RuntimeModule \p rm to the runtime module list.
   void addRuntimeModule(RuntimeModule *rm) {
     runtimeModuleList_.push_back(*rm);
@@ -1099,6 +1138,11 @@ class Runtime : public HandleRootOwner,
   /// to be scanned as roots in young-gen collections.
   std::vector<PinnedHermesValue> charStrings_{};
 
+  /// StringPrimitive representation of the integers below
+  /// kNumSmallIntStrings, or undefined for those which haven't been used yet.
+  /// Like charStrings_, these are allocated as "long-lived" objects.
+  PinnedHermesValue smallIntStrings_[kNumSmallIntStrings];
+
   /// Pointers to native implementations of builtins.
   std::vector<NativeFunction *> builtins_{};
 
@@ -1326,11 +1370,28 @@ class Runtime : public HandleRootOwner,
 
   /// Disable allocation location tracking for new objects. Old objects tagged
   /// with stack traces continue to be tracked until they are freed.
-  /// \param clearExistingTree is for use by tests and in general will break
-  /// because old objects would end up with dead pointers to stack-trace nodes.
+  /// \param clearExistingTree is for use by tests: it also drops the
+  /// stack-traces of old objects, and releases the stack-traces tree unless
+  /// the sampling heap profiler still uses it.
   void disableAllocationLocationTracker(bool clearExistingTree = false);
 
+  /// Enable the sampling heap profiler, which attaches a stack-trace to
+  /// allocations sampled on average once every \p samplingInterval bytes.
+  /// Only works with HERMES_ENABLE_ALLOCATION_LOCATION_TRACES.
+  /// \param seed If non-negative, used to seed the random sampling, for
+  ///   reproducible profiles.
+  void enableSamplingHeapProfiler(size_t samplingInterval, int64_t seed = -1);
+
+  /// Disable the sampling heap profiler and write a profile of the sampled
+  /// allocations which are still alive to \p os, in the Chrome DevTools
+  /// sampling heap profile format. The stack-traces tree is released unless
+  /// the allocation location tracker still uses it.
+  void disableSamplingHeapProfiler(llvm::raw_ostream &os);
+
  private:
+  /// Release the stack-traces tree if no tracker is enabled and no old
+  /// allocation refers to its nodes.
+  void freeStackTracesTreeIfUnused();
   void popCallStackImpl();
   void pushCallStackImpl(const CodeBlock *codeBlock, const inst::Inst *ip);
   std::unique_ptr<StackTracesTree> stackTracesTree_;
@@ -1648,7 +1709,7 @@ inline BasicBlockExecutionInfo &Runtime::getBasicBlockExecutionInfo() {
 }
 
 inline void Runtime::dumpBasicBlockProfileTrace(llvm::raw_ostream &OS) {
-  basicBlockExecInfo_.dump(OS);
+  basicBlockExecInfo_.dump(OS, this);
 }
 #endif
 
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_VM_RUNTIMEIMAGE_H
+#define HERMES_VM_RUNTIMEIMAGE_H
+
+#ifdef HERMESVM_SERIALIZE
+#include "hermes/VM/Runtime.h"
+#include "hermes/VM/SerializeHeader.h"
+
+#include "llvm/Support/MemoryBuffer.h"
+
+#include <memory>
+
+namespace hermes {
+namespace vm {
+
+/// A RuntimeImage is the serialized heap of an initialized Runtime, kept in
+/// memory so that new runtimes can be created from it in-process without
+/// running their initialization again. The image is immutable once captured
+/// and may be instantiated from several threads at once. All the runtimes
+/// created from one image share its buffer: the bytecode of the captured
+/// runtime modules is used in place from it, and only the heap objects are
+/// copied into each new runtime.
+class RuntimeImage {
+ public:
+  /// Capture the heap of \p runtime. This does a full collection first.
+  /// \param externalPointers returns the native pointers, such as host
+  ///   functions, which the heap of \p runtime refers to. They must be the
+  ///   same when the image is instantiated.
+  static std::shared_ptr<const RuntimeImage> capture(
+      Runtime *runtime,
+      ExternalPointersVectorFunction *externalPointers = noExternalPointers);
+
+  /// Create a new runtime from this image. \p runtimeConfig must match the
+  /// config of the captured runtime in the fields checked by the
+  /// SerializeHeader, such as the bytecode kind and the GC flags.
+  std::shared_ptr<Runtime> instantiate(
+      const RuntimeConfig &runtimeConfig) const;
+
+  /// \return the size of the image in bytes.
+  size_t size() const {
+    return buffer_->getBufferSize();
+  }
+
+ private:
+  RuntimeImage(
+      std::shared_ptr<llvm::MemoryBuffer> buffer,
+      ExternalPointersVectorFunction *externalPointers)
+      : buffer_(std::move(buffer)), externalPointers_(externalPointers) {}
+
+  /// The default externalPointers, for runtimes without host functions.
+  static std::vector<void *> noExternalPointers();
+
+  std::shared_ptr<llvm::MemoryBuffer> buffer_;
+  ExternalPointersVectorFunction *externalPointers_;
+};
+
+} // namespace vm
+} // namespace hermes
+
+#endif // HERMESVM_SERIALIZE
+#endif // HERMES_VM_RUNTIMEIMAGE_H
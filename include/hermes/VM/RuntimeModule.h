@@ -252,7 +252,7 @@ class RuntimeModule final : public llvm::ilist_node<RuntimeModule> {
     if (LLVM_UNLIKELY(!id.isValid())) {
       // Materialize this lazily created symbol.
       auto entry = bcProvider_->getStringTableEntry(stringID);
-      id = createSymbolFromStringIDMayAllocate(stringID, entry, llvm::None);
+      id = createSymbolFromStringIDMayAllocate(stringID, entry);
     }
     assert(id.isValid() && "Failed to create symbol for stringID");
     return id;
@@ -427,7 +427,7 @@ class RuntimeModule final : public llvm::ilist_node<RuntimeModule> {
   /// Computes the hash of the string when it's not supplied.
   template <typename T>
   SymbolID mapStringMayAllocate(llvm::ArrayRef<T> str, StringID stringID) {
-    return mapStringMayAllocate(str, stringID, hermes::hashString(str));
+    return mapStringMayAllocate(str, stringID, hermes::runtimeHashString(str));
   }
 
   /// Map the supplied string to a given \p stringID, register it in the
@@ -437,13 +437,13 @@ class RuntimeModule final : public llvm::ilist_node<RuntimeModule> {
   mapStringMayAllocate(llvm::ArrayRef<T> str, StringID stringID, uint32_t hash);
 
   /// Create a symbol from a given \p stringID, which is an index to the
-  /// string table, corresponding to the entry \p entry. If \p mhash is not
-  /// None, use it as the hash; otherwise compute the hash from the string
-  /// contents. \return the created symbol ID.
+  /// string table, corresponding to the entry \p entry. \p hash is the
+  /// runtimeHashString() of the string, if it is already known.
+  /// \return the created symbol ID.
   SymbolID createSymbolFromStringIDMayAllocate(
       StringID stringID,
       const StringTableEntry &entry,
-      OptValue<uint32_t> mhash);
+      llvm::Optional<uint32_t> hash = llvm::None);
 
   /// \return a unqiue hash key for object literal hidden class cache.
   /// \param keyBufferIndex value of NewObjectWithBuffer instruction(must be
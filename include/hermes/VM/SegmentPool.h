@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_VM_SEGMENTPOOL_H
+#define HERMES_VM_SEGMENTPOOL_H
+
+#include "hermes/VM/StorageProvider.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hermes {
+namespace vm {
+
+/// A SegmentPool keeps the storage of deleted segments, up to a cap, so that
+/// it can be handed to the next runtime which needs a segment instead of being
+/// unmapped and mapped again. It may be shared by runtimes running on
+/// different threads. Pooled storage is returned to the OS with vm_unused(),
+/// so it keeps its address range but not its physical pages. Since
+/// vm_unused() may use MADV_FREE, which lets the OS keep the old contents
+/// until it needs the pages, reused storage is not guaranteed to be zeroed.
+class SegmentPool {
+ public:
+  /// \param upstream Provider of the storage when the pool is empty, and
+  ///   which takes back storage when the pool is full.
+  /// \param maxPooled The maximum number of storages kept in the pool.
+  SegmentPool(std::unique_ptr<StorageProvider> upstream, size_t maxPooled);
+
+  /// Deletes all the pooled storage.
+  ~SegmentPool();
+
+  /// \return the pool shared by all the runtimes of this process, which gets
+  ///   its storage from StorageProvider::mmapProvider(). It starts with a cap
+  ///   of zero, which raiseMaxPooled() increases.
+  static std::shared_ptr<SegmentPool> processPool();
+
+  /// Take a storage from the pool, or create one if the pool is empty.
+  llvm::ErrorOr<void *> acquire(const char *name);
+
+  /// Put \p storage in the pool, or delete it if the pool is full.
+  void release(void *storage);
+
+  /// Raise the cap on the number of pooled storages to \p maxPooled, if it is
+  /// lower.
+  void raiseMaxPooled(size_t maxPooled);
+
+  /// \return the number of storages in the pool.
+  size_t numPooled() const;
+
+  /// \return the number of acquired storages which came from the pool.
+  size_t numReused() const;
+
+ private:
+  /// Guards all the fields below.
+  mutable std::mutex mutex_;
+  std::unique_ptr<StorageProvider> upstream_;
+  size_t maxPooled_;
+  std::vector<void *> pooled_;
+  size_t numReused_{0};
+};
+
+/// A PooledStorageProvider gets the storage of one runtime from a SegmentPool
+/// shared with other runtimes. The provider's own counts only cover the
+/// storage of its runtime, so it can be wrapped in a LimitedStorageProvider to
+/// limit that runtime.
+class PooledStorageProvider final : public StorageProvider {
+  std::shared_ptr<SegmentPool> pool_;
+
+ public:
+  explicit PooledStorageProvider(std::shared_ptr<SegmentPool> pool)
+      : pool_(std::move(pool)) {}
+
+ protected:
+  llvm::ErrorOr<void *> newStorageImpl(const char *name) override;
+
+  void deleteStorageImpl(void *storage) override;
+};
+
+} // namespace vm
+} // namespace hermes
+
+#endif
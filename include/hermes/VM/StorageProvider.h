@@ -8,6 +8,7 @@
 #ifndef HERMES_VM_STORAGEPROVIDER_H
 #define HERMES_VM_STORAGEPROVIDER_H
 
+#include "llvm/ADT/Optional.h"
 #include "llvm/Support/ErrorOr.h"
 
 #include <limits>
@@ -32,6 +33,16 @@ class StorageProvider {
   /// Provide storage via malloc.
   static std::unique_ptr<StorageProvider> mallocProvider();
 
+  /// Provide storage from mmap'ed separate regions, and ask the OS to back
+  /// them with transparent huge pages where it supports them.
+  /// \param prefault Fault in every page of a new storage before returning
+  ///   it, so the GC doesn't take page faults while using it.
+  /// \param preferLocalNUMANode Prefer allocating pages on the NUMA node of
+  ///   the thread calling this function.
+  static std::unique_ptr<StorageProvider> hugePageProvider(
+      bool prefault,
+      bool preferLocalNUMANode);
+
   /// @}
 
   /// Create a new segment memory space.
@@ -62,6 +73,13 @@ class StorageProvider {
   /// deleted yet.
   size_t numLiveAllocs() const;
 
+  /// \return the number of bytes of live storage which are currently backed
+  ///   by huge pages, or None if this provider doesn't use huge pages or the
+  ///   platform can't tell.
+  virtual llvm::Optional<size_t> hugePageBytes() const {
+    return llvm::None;
+  }
+
  protected:
   virtual llvm::ErrorOr<void *> newStorageImpl(const char *name) = 0;
   virtual void deleteStorageImpl(void *storage) = 0;
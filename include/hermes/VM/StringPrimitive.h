@@ -35,6 +35,8 @@ class StringPrimitive : public VariableSizeRuntimeCell {
   friend class StringView;
   template <typename T>
   friend class BufferedStringPrimitive;
+  template <typename T>
+  friend class SlicedStringPrimitive;
 
   friend llvm::raw_ostream &operator<<(
       llvm::raw_ostream &OS,
@@ -138,6 +140,17 @@ class StringPrimitive : public VariableSizeRuntimeCell {
   static constexpr uint32_t CONCAT_STRING_MIN_SIZE =
       256 > EXTERNAL_STRING_MIN_SIZE ? 256 : EXTERNAL_STRING_MIN_SIZE;
 
+  /// Slices of at least this length reference the storage of the sliced string
+  /// with a SlicedStringPrimitive. Shorter slices are cheaper to copy than to
+  /// reference.
+  static constexpr uint32_t SLICED_STRING_MIN_SIZE = 32;
+
+  /// A SlicedStringPrimitive never keeps alive a string larger than
+  /// EXTERNAL_STRING_THRESHOLD which is more than this many times its own
+  /// length. Smaller slices of huge strings are copied instead, so that they
+  /// don't retain the whole string.
+  static constexpr uint32_t SLICED_STRING_MAX_PARENT_RATIO = 64;
+
   static bool classof(const GCCell *cell) {
     return kindInRange(
         cell->getKind(),
@@ -240,6 +253,8 @@ class StringPrimitive : public VariableSizeRuntimeCell {
       Handle<StringPrimitive> yHandle);
 
   /// Slice the StringPrimitive at \p str, \p length characters at \p start.
+  /// Long enough slices share the storage of \p str, see
+  /// SLICED_STRING_MIN_SIZE.
   /// \return new StringPrimitive, representing the sliced string.
   static CallResult<HermesValue> slice(
       Runtime *runtime,
@@ -774,6 +789,119 @@ inline bool isBufferedStringPrimitive(const GCCell *cell) {
       cell->getKind() == CellKind::BufferedASCIIStringPrimitiveKind;
 }
 
+/// \return true if this is one of the SlicedStringPrimitive classes.
+inline bool isSlicedStringPrimitive(const GCCell *cell) {
+  return cell->getKind() == CellKind::SlicedUTF16StringPrimitiveKind ||
+      cell->getKind() == CellKind::SlicedASCIIStringPrimitiveKind;
+}
+
+/// An immutable JavaScript primitive consisting of a reference to another
+/// string, an offset and a length. This is the result of slicing a string (for
+/// instance with String.prototype.substring or split), and avoids copying the
+/// characters of the slice.
+///
+/// The referenced "parent" string is never itself a SlicedStringPrimitive, so
+/// access to the characters is always a single indirection. Since the parent
+/// may be moved by the GC, the pointer to the characters is recomputed on
+/// every access, like for any other string.
+///
+/// A slice keeps its whole parent alive. StringPrimitive::slice() only creates
+/// slices of strings which are not excessively larger than the slice, and
+/// copies the characters otherwise. Operations which need storage of their own
+/// (uniquing as an identifier, or concatenation) copy the characters, which
+/// flattens the slice.
+template <typename T>
+class SlicedStringPrimitive final : public StringPrimitive {
+  friend class StringPrimitive;
+  friend void SlicedASCIIStringPrimitiveBuildMeta(
+      const GCCell *cell,
+      Metadata::Builder &mb);
+  friend void SlicedUTF16StringPrimitiveBuildMeta(
+      const GCCell *cell,
+      Metadata::Builder &mb);
+
+  /// \return the cell kind for this string.
+  static constexpr CellKind getCellKind() {
+    return std::is_same<T, char16_t>::value
+        ? CellKind::SlicedUTF16StringPrimitiveKind
+        : CellKind::SlicedASCIIStringPrimitiveKind;
+  }
+
+ public:
+#ifdef HERMESVM_SERIALIZE
+  template <typename>
+  friend void serializeSlicedStringImpl(Serializer &s, const GCCell *cell);
+
+  template <typename>
+  friend void deserializeSlicedStringImpl(Deserializer &d);
+#endif
+
+  static bool classof(const GCCell *cell) {
+    return cell->getKind() == SlicedStringPrimitive::getCellKind();
+  }
+
+  /// \return the string whose characters this slice references.
+  StringPrimitive *getParent() const {
+    return vmcast<StringPrimitive>(parentHV_);
+  }
+
+  /// \return the index of the first character of the slice in the parent.
+  uint32_t getOffset() const {
+    return offset_;
+  }
+
+ private:
+  static const VTable vt;
+
+  /// Construct a slice of \p length characters of \p parent, starting at
+  /// \p offset.
+  SlicedStringPrimitive(
+      Runtime *runtime,
+      StringPrimitive *parent,
+      uint32_t offset,
+      uint32_t length)
+      : StringPrimitive(
+            runtime,
+            &vt,
+            sizeof(SlicedStringPrimitive<T>),
+            length),
+        offset_(offset) {
+    parentHV_.set(HermesValue::encodeStringValue(parent), &runtime->getHeap());
+    assert(!isSlicedStringPrimitive(parent) && "slices cannot be nested");
+    assert(
+        offset + length <= parent->getStringLength() &&
+        "slice exceeds the parent string");
+  }
+
+#ifdef HERMESVM_SERIALIZE
+  /// Construct a slice whose parent is read afterwards by the Deserializer.
+  SlicedStringPrimitive(Deserializer &d, uint32_t offset, uint32_t length);
+#endif
+
+  /// Allocate a slice of \p length characters of \p parent, starting at
+  /// \p offset.
+  /// \pre \p parent is not a SlicedStringPrimitive and its characters are of
+  /// type T.
+  static PseudoHandle<StringPrimitive> create(
+      Runtime *runtime,
+      Handle<StringPrimitive> parent,
+      uint32_t offset,
+      uint32_t length);
+
+  /// \return a const pointer to the first character of the string.
+  const T *getRawPointer() const {
+    return getParent()->template castToPointer<T>() + offset_;
+  }
+
+  /// Reference to the string whose characters this slice references.
+  /// Like BufferedStringPrimitive, we use a GCHermesValue instead of a
+  /// GCPointer to avoid having to pass a PointerBase around.
+  GCHermesValue parentHV_;
+
+  /// The index of the first character of the slice in the parent.
+  uint32_t offset_;
+};
+
 /// This function is not part of the API and is not supposed to be called
 /// directly. It is used internally by StringPrimitive::concat. It is used
 /// to handle the case when the result string exceeds the minimal length for
@@ -857,6 +985,26 @@ const VTable BufferedStringPrimitive<T>::vt = VTable(
 using BufferedUTF16StringPrimitive = BufferedStringPrimitive<char16_t>;
 using BufferedASCIIStringPrimitive = BufferedStringPrimitive<char>;
 
+template <typename T>
+const VTable SlicedStringPrimitive<T>::vt = VTable(
+    SlicedStringPrimitive<T>::getCellKind(),
+    sizeof(SlicedStringPrimitive<T>),
+    nullptr, // finalize.
+    nullptr, // markWeak.
+    nullptr, // mallocSize
+    nullptr,
+    nullptr,
+    nullptr, // externalMemorySize
+    VTable::HeapSnapshotMetadata{
+        HeapSnapshot::NodeType::String,
+        SlicedStringPrimitive<T>::_snapshotNameImpl,
+        nullptr,
+        nullptr,
+        nullptr});
+
+using SlicedUTF16StringPrimitive = SlicedStringPrimitive<char16_t>;
+using SlicedASCIIStringPrimitive = SlicedStringPrimitive<char>;
+
 //===----------------------------------------------------------------------===//
 // StringPrimitive inline methods.
 
@@ -994,6 +1142,8 @@ inline const char *StringPrimitive::castToASCIIPointer() const {
     return vmcast<DynamicUniquedASCIIStringPrimitive>(this)->getRawPointer();
   } else if (vmisa<DynamicASCIIStringPrimitive>(this)) {
     return vmcast<DynamicASCIIStringPrimitive>(this)->getRawPointer();
+  } else if (vmisa<SlicedASCIIStringPrimitive>(this)) {
+    return vmcast<SlicedASCIIStringPrimitive>(this)->getRawPointer();
   } else {
     return vmcast<BufferedASCIIStringPrimitive>(this)->getRawPointer();
   }
@@ -1006,6 +1156,8 @@ inline const char16_t *StringPrimitive::castToUTF16Pointer() const {
     return vmcast<DynamicUniquedUTF16StringPrimitive>(this)->getRawPointer();
   } else if (vmisa<DynamicUTF16StringPrimitive>(this)) {
     return vmcast<DynamicUTF16StringPrimitive>(this)->getRawPointer();
+  } else if (vmisa<SlicedUTF16StringPrimitive>(this)) {
+    return vmcast<SlicedUTF16StringPrimitive>(this)->getRawPointer();
   } else {
     return vmcast<BufferedUTF16StringPrimitive>(this)->getRawPointer();
   }
@@ -1061,6 +1213,8 @@ inline bool StringPrimitive::isASCII() const {
           CellKind::DynamicASCIIStringPrimitiveKind,
           CellKind::BufferedUTF16StringPrimitiveKind,
           CellKind::BufferedASCIIStringPrimitiveKind,
+          CellKind::SlicedUTF16StringPrimitiveKind,
+          CellKind::SlicedASCIIStringPrimitiveKind,
           CellKind::DynamicUniquedUTF16StringPrimitiveKind,
           CellKind::DynamicUniquedASCIIStringPrimitiveKind,
           CellKind::ExternalUTF16StringPrimitiveKind,
@@ -1080,6 +1234,8 @@ inline bool StringPrimitive::isExternal() const {
           CellKind::DynamicASCIIStringPrimitiveKind,
           CellKind::BufferedUTF16StringPrimitiveKind,
           CellKind::BufferedASCIIStringPrimitiveKind,
+          CellKind::SlicedUTF16StringPrimitiveKind,
+          CellKind::SlicedASCIIStringPrimitiveKind,
           CellKind::DynamicUniquedUTF16StringPrimitiveKind,
           CellKind::DynamicUniquedASCIIStringPrimitiveKind,
           CellKind::ExternalUTF16StringPrimitiveKind,
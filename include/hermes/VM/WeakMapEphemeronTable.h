@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_VM_WEAKMAPEPHEMERONTABLE_H
+#define HERMES_VM_WEAKMAPEPHEMERONTABLE_H
+
+#include "hermes/VM/CellKind.h"
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+
+#include <vector>
+
+namespace hermes {
+namespace vm {
+
+namespace detail {
+struct WeakRefKey;
+}
+template <CellKind C>
+class JSWeakMapImpl;
+using JSWeakMap = JSWeakMapImpl<CellKind::WeakMapKind>;
+
+class GCCell;
+
+/// The entries of reachable WeakMaps whose keys have not been marked yet
+/// (ephemerons), indexed by key. While WeakMap marking is in progress, the
+/// collector reports every cell it marks through cellMarked(), which makes the
+/// entries of that key ready. This way each entry is looked at once when its
+/// WeakMap is scanned and at most once more when its key is marked, instead
+/// of rescanning all WeakMaps until no more values are marked.
+class WeakMapEphemeronTable {
+ public:
+  /// An entry of a WeakMap whose value must be marked if its key is.
+  struct Entry {
+    JSWeakMap *weakMap;
+    detail::WeakRefKey *key;
+  };
+
+  /// Record that the value of \p key in \p weakMap must be marked once
+  /// \p keyCell is marked.
+  void addPending(
+      GCCell *keyCell,
+      JSWeakMap *weakMap,
+      detail::WeakRefKey *key) {
+    pending_[keyCell].push_back(Entry{weakMap, key});
+  }
+
+  /// Called by the collector whenever it marks \p cell. Cheap enough to be
+  /// called for every marked cell: it only checks whether \p cell is the key
+  /// of a pending entry.
+  void cellMarked(GCCell *cell) {
+    if (!pending_.empty() && pending_.count(cell)) {
+      markedKeys_.push_back(cell);
+    }
+  }
+
+  /// Move the entries whose keys were marked since the last call to
+  /// \p entries, replacing its contents.
+  /// \return false if there were no such entries.
+  bool takeReadyEntries(llvm::SmallVectorImpl<Entry> &entries) {
+    entries.clear();
+    while (!markedKeys_.empty()) {
+      auto it = pending_.find(markedKeys_.back());
+      markedKeys_.pop_back();
+      // A key may have been reported more than once.
+      if (it != pending_.end()) {
+        entries.append(it->second.begin(), it->second.end());
+        pending_.erase(it);
+      }
+    }
+    return !entries.empty();
+  }
+
+ private:
+  /// Entries with unmarked keys, indexed by key.
+  llvm::DenseMap<GCCell *, llvm::SmallVector<Entry, 1>> pending_;
+
+  /// Keys of pending entries which have been marked.
+  std::vector<GCCell *> markedKeys_;
+};
+
+} // namespace vm
+} // namespace hermes
+
+#endif // HERMES_VM_WEAKMAPEPHEMERONTABLE_H
@@ -137,7 +137,7 @@ class IdentifierHashTable {
   /// \return index if found. If not found, \return the index to insert at.
   template <typename T>
   uint32_t lookupString(llvm::ArrayRef<T> str, bool mustBeNew = false) const {
-    return lookupString(str, hermes::hashString(str), mustBeNew);
+    return lookupString(str, hermes::runtimeHashString(str), mustBeNew);
   }
 
   /// Find the index in the hash table given \p str.
@@ -8,6 +8,7 @@
 #include "hermes/BCGen/HBC/BytecodeDataProvider.h"
 #include "hermes/BCGen/HBC/BytecodeFileFormat.h"
 #include "hermes/Support/ErrorHandling.h"
+#include "hermes/Support/HashString.h"
 #include "hermes/Support/OSCompat.h"
 #include "hermes/VM/Deserializer.h"
 #include "hermes/VM/Serializer.h"
@@ -277,6 +278,31 @@ bool BytecodeFileFields<Mutable>::populateFromBuffer(
 template struct BytecodeFileFields<false>;
 template struct BytecodeFileFields<true>;
 
+llvm::ArrayRef<uint32_t> BCProviderBase::getRuntimeIdentifierHashes() {
+  std::call_once(runtimeIdentifierHashesOnce_, [this]() {
+    runtimeIdentifierHashes_.reserve(identifierHashes_.size());
+    StringID strID = 0;
+    for (auto entry : stringKinds_) {
+      if (entry.kind() == StringKind::String) {
+        strID += entry.count();
+        continue;
+      }
+      for (uint32_t i = 0; i < entry.count(); ++i, ++strID) {
+        auto tableEntry = getStringTableEntry(strID);
+        const unsigned char *s =
+            stringStorage_.begin() + tableEntry.getOffset();
+        runtimeIdentifierHashes_.push_back(
+            tableEntry.isUTF16()
+                ? runtimeHashString(llvm::ArrayRef<char16_t>(
+                      (const char16_t *)s, tableEntry.getLength()))
+                : runtimeHashString(llvm::ArrayRef<char>(
+                      (const char *)s, tableEntry.getLength())));
+      }
+    }
+  });
+  return runtimeIdentifierHashes_;
+}
+
 int32_t BCProviderBase::findCatchTargetOffset(
     uint32_t functionID,
     uint32_t exceptionOffset) const {
@@ -140,6 +140,19 @@ OptValue<DebugSourceLocation> DebugInfo::getLocationForAddress(
   return llvm::None;
 }
 
+OptValue<DebugSourceLocation> DebugInfo::getLocationForFunction(
+    uint32_t debugOffset) const {
+  assert(debugOffset < data_.size() && "Debug offset out of range");
+  // The function's location precedes the locations of its instructions.
+  FunctionDebugInfoDeserializer fdid(data_.getData(), debugOffset);
+  if (auto file = getFilenameForAddress(debugOffset)) {
+    DebugSourceLocation location = fdid.getCurrent();
+    location.filenameId = *file;
+    return location;
+  }
+  return llvm::None;
+}
+
 OptValue<DebugSearchResult> DebugInfo::getAddressForLocation(
     uint32_t filenameId,
     uint32_t targetLine,
@@ -27,6 +27,7 @@ using llvm::Optional;
 #define INCLUDE_HBC_INSTRS
 
 STATISTIC(NumJumpPass, "Number of passes to resolve all jump targets");
+STATISTIC(NumSuperInstructions, "Number of superinstructions emitted");
 STATISTIC(
     NumUncachedNodes,
     "Number of put/get property instructions with property caching disabled");
@@ -79,6 +80,78 @@ unsigned HBCISel::encodeValue(Value *value) {
   }
 }
 
+BinaryOperatorInst *HBCISel::findFusibleArithmetic(
+    CompareBranchInst *CBI,
+    BasicBlock *next) {
+  // Fusing would make two statements a single step for the debugger.
+  if (!F_->getContext().getOptimizationSettings().superInstructions ||
+      F_->getContext().getDebugInfoSetting() == DebugInfoSetting::ALL) {
+    return nullptr;
+  }
+
+  // Only the branches which aren't inverted to fall through to the "true"
+  // block have a fused form. This is the common case for loop back edges.
+  if (next == CBI->getTrueDest())
+    return nullptr;
+
+  // Look through the copies which the register allocator coalesced into the
+  // same register, typically from phi lowering.
+  Value *lhs = CBI->getLeftHandSide();
+  while (auto *mov = llvm::dyn_cast<MovInst>(lhs)) {
+    if (encodeValue(mov) != encodeValue(mov->getSingleOperand()))
+      return nullptr;
+    lhs = mov->getSingleOperand();
+  }
+
+  auto *arith = llvm::dyn_cast<BinaryOperatorInst>(lhs);
+  if (!arith || arith->getParent() != CBI->getParent() ||
+      !arith->getLeftHandSide()->getType().isNumberType() ||
+      !arith->getRightHandSide()->getType().isNumberType()) {
+    return nullptr;
+  }
+
+  using OpKind = BinaryOperatorInst::OpKind;
+  switch (CBI->getOperatorKind()) {
+    case OpKind::LessThanKind:
+    case OpKind::LessThanOrEqualKind:
+      if (arith->getOperatorKind() != OpKind::AddKind)
+        return nullptr;
+      break;
+    case OpKind::GreaterThanKind:
+    case OpKind::GreaterThanOrEqualKind:
+      if (arith->getOperatorKind() != OpKind::SubtractKind)
+        return nullptr;
+      break;
+    default:
+      return nullptr;
+  }
+
+  unsigned res = encodeValue(arith);
+  unsigned left = encodeValue(arith->getLeftHandSide());
+  unsigned right = encodeValue(arith->getRightHandSide());
+  unsigned cmpRight = encodeValue(CBI->getRightHandSide());
+  if (std::max({res, left, right, cmpRight}) > UINT8_MAX)
+    return nullptr;
+
+  // The arithmetic will execute after the instructions between it and the
+  // branch, so they must not observe its result or modify its operands.
+  for (auto it = std::next(arith->getIterator()), e = CBI->getIterator();
+       it != e;
+       ++it) {
+    auto *mov = llvm::dyn_cast<MovInst>(&*it);
+    if (!mov)
+      return nullptr;
+    unsigned dst = encodeValue(mov);
+    unsigned src = encodeValue(mov->getSingleOperand());
+    if (dst == src)
+      continue;
+    if (src == res || dst == res || dst == left || dst == right)
+      return nullptr;
+  }
+
+  return arith;
+}
+
 void HBCISel::registerLongJump(offset_t loc, BasicBlock *target) {
   relocations_.push_back(
       {loc, Relocation::RelocationType::LongJumpType, target});
@@ -560,7 +633,10 @@ void HBCISel::generateStorePropertyInst(
   }
 
   auto propReg = encodeValue(prop);
-  BCFGen_->emitPutByVal(objReg, propReg, valueReg);
+  if (prop->getType().isNumberType())
+    BCFGen_->emitPutByValN(objReg, propReg, valueReg);
+  else
+    BCFGen_->emitPutByVal(objReg, propReg, valueReg);
 }
 
 void HBCISel::generateTryStoreGlobalPropertyInst(
@@ -697,7 +773,10 @@ void HBCISel::generateLoadPropertyInst(
   }
 
   auto propReg = encodeValue(prop);
-  BCFGen_->emitGetByVal(resultReg, objReg, propReg);
+  if (prop->getType().isNumberType())
+    BCFGen_->emitGetByValN(resultReg, objReg, propReg);
+  else
+    BCFGen_->emitGetByVal(resultReg, objReg, propReg);
 }
 
 void HBCISel::generateTryLoadGlobalPropertyInst(
@@ -962,6 +1041,11 @@ void HBCISel::generateCondBranchInst(CondBranchInst *Inst, BasicBlock *next) {
 void HBCISel::generateCompareBranchInst(
     CompareBranchInst *Inst,
     BasicBlock *next) {
+  if (fusedArithmetic_) {
+    generateArithCompareBranch(Inst, fusedArithmetic_, next);
+    return;
+  }
+
   auto left = encodeValue(Inst->getLeftHandSide());
   auto right = encodeValue(Inst->getRightHandSide());
   auto res = encodeValue(Inst);
@@ -1050,6 +1134,48 @@ void HBCISel::generateCompareBranchInst(
   loc = BCFGen_->emitJmpLong(res);
   registerLongJump(loc, falseBlock);
 }
+void HBCISel::generateArithCompareBranch(
+    CompareBranchInst *Inst,
+    BinaryOperatorInst *arith,
+    BasicBlock *next) {
+  auto res = encodeValue(arith);
+  auto left = encodeValue(arith->getLeftHandSide());
+  auto right = encodeValue(arith->getRightHandSide());
+  auto cmpRight = encodeValue(Inst->getRightHandSide());
+  assert(
+      res == encodeValue(Inst->getLeftHandSide()) &&
+      "arithmetic must produce the left operand of the comparison");
+
+  using OpKind = BinaryOperatorInst::OpKind;
+  offset_t loc;
+  switch (Inst->getOperatorKind()) {
+    case OpKind::LessThanKind: // <
+      loc = BCFGen_->emitAddNJLessLong(0, res, left, right, cmpRight);
+      break;
+    case OpKind::LessThanOrEqualKind: // <=
+      loc = BCFGen_->emitAddNJLessEqualLong(0, res, left, right, cmpRight);
+      break;
+    case OpKind::GreaterThanKind: // >
+      loc = BCFGen_->emitSubNJGreaterLong(0, res, left, right, cmpRight);
+      break;
+    case OpKind::GreaterThanOrEqualKind: // >=
+      loc = BCFGen_->emitSubNJGreaterEqualLong(0, res, left, right, cmpRight);
+      break;
+    default:
+      llvm_unreachable("invalid arithmetic compare+branch operator");
+  }
+  ++NumSuperInstructions;
+
+  registerLongJump(loc, Inst->getTrueDest());
+
+  BasicBlock *falseBlock = Inst->getFalseDest();
+  if (next == falseBlock) {
+    return;
+  }
+
+  loc = BCFGen_->emitJmpLong(0);
+  registerLongJump(loc, falseBlock);
+}
 void HBCISel::generateGetPNamesInst(GetPNamesInst *Inst, BasicBlock *next) {
   auto itrReg = encodeValue(Inst->getIterator());
   BCFGen_->emitGetPNameList(
@@ -1513,6 +1639,12 @@ void HBCISel::generate(BasicBlock *BB, BasicBlock *next) {
   // CreateEnvironment instruction.
   const Instruction *asyncBreakCheckLoc =
       asyncBreakChecks_.count(BB) ? BB->getTerminator() : nullptr;
+
+  // Check whether the terminator can absorb an arithmetic instruction into a
+  // superinstruction, in which case the latter is skipped below.
+  auto *CBI = llvm::dyn_cast<CompareBranchInst>(BB->getTerminator());
+  fusedArithmetic_ = CBI ? findFusibleArithmetic(CBI, next) : nullptr;
+
   for (auto &I : *BB) {
     if (&I == asyncBreakCheckLoc) {
       BCFGen_->emitAsyncBreakCheck();
@@ -1537,6 +1669,10 @@ void HBCISel::generate(BasicBlock *BB, BasicBlock *next) {
 void HBCISel::generate(Instruction *ii, BasicBlock *next) {
   LLVM_DEBUG(dbgs() << "Generating the instruction " << ii->getName() << "\n");
 
+  // The instruction will be emitted as part of the block terminator.
+  if (ii == fusedArithmetic_)
+    return;
+
   // Generate the debug info.
   switch (F_->getContext().getDebugInfoSetting()) {
     case DebugInfoSetting::THROWING:
@@ -453,6 +453,47 @@ static opt<bool> ReusePropCache(
 static CLFlag
     Inline('f', "inline", true, "inlining of functions", CompilerCategory);
 
+static CLFlag InlineMultipleCallSites(
+    'f',
+    "inline-multiple-call-sites",
+    true,
+    "inlining of small functions with multiple call sites",
+    CompilerCategory);
+
+static opt<unsigned> InliningMaxCalleeSize(
+    "inline-max-size",
+    init(InliningSettings{}.maxCalleeSize),
+    desc("Maximum size of functions inlined into multiple call sites"),
+    Hidden,
+    cat(CompilerCategory));
+
+static opt<unsigned> InliningMaxHotCalleeSize(
+    "inline-max-hot-size",
+    init(InliningSettings{}.maxHotCalleeSize),
+    desc("Maximum size of functions inlined into hot call sites"),
+    Hidden,
+    cat(CompilerCategory));
+
+static opt<unsigned> InliningMaxGrowthPercent(
+    "inline-max-growth",
+    init(InliningSettings{}.maxGrowthPercent),
+    desc("Maximum growth of the code size due to inlining, in percent"),
+    Hidden,
+    cat(CompilerCategory));
+
+static opt<unsigned> InliningHotCallCount(
+    "inline-hot-count",
+    init(InliningSettings{}.hotCallCount),
+    desc("Minimum number of calls for a call site to be considered hot"),
+    Hidden,
+    cat(CompilerCategory));
+
+static opt<std::string> InliningProfile(
+    "inline-profile",
+    desc("Basic block profile, as dumped by -basic-block-profiling, "
+         "used to guide inlining"),
+    cat(CompilerCategory));
+
 static CLFlag Outline(
     'f',
     "outline",
@@ -460,6 +501,13 @@ static CLFlag Outline(
     "IR outlining to reduce code size",
     CompilerCategory);
 
+static CLFlag SuperInstructions(
+    'f',
+    "superinstructions",
+    true,
+    "fusing of common instruction sequences into superinstructions",
+    CompilerCategory);
+
 static CLFlag StripFunctionNames(
     'f',
     "strip-function-names",
@@ -927,7 +975,8 @@ bool validateFlags() {
 /// \return the Context.
 std::shared_ptr<Context> createContext(
     std::unique_ptr<Context::ResolutionTable> resolutionTable,
-    std::vector<Context::SegmentRange> segmentRanges) {
+    std::vector<Context::SegmentRange> segmentRanges,
+    std::shared_ptr<const ExecutionProfile> inliningProfile) {
   CodeGenerationSettings codeGenOpts;
   codeGenOpts.enableTDZ = cl::EnableTDZ;
   codeGenOpts.dumpOperandRegisters = cl::DumpOperandRegisters;
@@ -951,6 +1000,16 @@ std::shared_ptr<Context> createContext(
 
   optimizationOpts.inlining = cl::OptimizationLevel != cl::OptLevel::O0 &&
       cl::BytecodeFormat == cl::BytecodeFormatKind::HBC && cl::Inline;
+  optimizationOpts.inliningSettings.multipleCallSites =
+      cl::InlineMultipleCallSites;
+  optimizationOpts.inliningSettings.maxCalleeSize = cl::InliningMaxCalleeSize;
+  optimizationOpts.inliningSettings.maxHotCalleeSize =
+      cl::InliningMaxHotCalleeSize;
+  optimizationOpts.inliningSettings.maxGrowthPercent =
+      cl::InliningMaxGrowthPercent;
+  optimizationOpts.inliningSettings.hotCallCount = cl::InliningHotCallCount;
+  optimizationOpts.inliningSettings.profile = std::move(inliningProfile);
+
   optimizationOpts.outlining =
       cl::OptimizationLevel != cl::OptLevel::O0 && cl::Outline;
 
@@ -962,6 +1021,7 @@ std::shared_ptr<Context> createContext(
   optimizationOpts.outliningSettings.maxParameters = cl::OutliningMaxParameters;
 
   optimizationOpts.reusePropCache = cl::ReusePropCache;
+  optimizationOpts.superInstructions = cl::SuperInstructions;
 
   // When the setting is auto-detect, we will set the correct value after
   // parsing.
@@ -1270,6 +1330,89 @@ bool readBaseBytecodeMap(
   return true;
 }
 
+/// Read a basic block profile, as dumped by the VM with
+/// -basic-block-profiling, and compute the execution counts of every function
+/// in it. Functions are identified by their source location, which is only
+/// in the profile if the profiled bytecode had debug info; other functions
+/// are ignored.
+/// Prints out error messages to stderr in case of failure.
+/// \param filename the path to the profile.
+/// \return the execution profile, nullptr on failure.
+std::shared_ptr<const ExecutionProfile> readExecutionProfile(
+    llvm::StringRef filename) {
+  using namespace ::hermes::parser;
+
+  auto profileBuf = memoryBufferFromFile(filename);
+  if (!profileBuf)
+    return nullptr;
+
+  JSLexer::Allocator alloc;
+  auto *profileVal = parseJSONFile(profileBuf, alloc);
+  if (!profileVal) {
+    // parseJSONFile prints any error messages.
+    return nullptr;
+  }
+
+  auto *root = dyn_cast<JSONObject>(profileVal);
+  auto *functions = root
+      ? llvm::dyn_cast_or_null<JSONArray>(root->get("functions"))
+      : nullptr;
+  if (!functions) {
+    llvm::errs() << "Execution profile must contain a list of functions\n";
+    return nullptr;
+  }
+
+  auto result = std::make_shared<ExecutionProfile>();
+  unsigned numWithoutLocation = 0;
+  for (const JSONValue *funcVal : *functions) {
+    auto *func = dyn_cast<JSONObject>(funcVal);
+    auto *name =
+        func ? llvm::dyn_cast_or_null<JSONString>(func->get("name")) : nullptr;
+    auto *blocks = func
+        ? llvm::dyn_cast_or_null<JSONArray>(func->get("basic_blocks"))
+        : nullptr;
+    if (!name || !blocks) {
+      llvm::errs() << "Invalid function in execution profile\n";
+      return nullptr;
+    }
+    auto *file = llvm::dyn_cast_or_null<JSONString>(func->get("file"));
+    auto *line = llvm::dyn_cast_or_null<JSONNumber>(func->get("line"));
+    auto *column = llvm::dyn_cast_or_null<JSONNumber>(func->get("column"));
+    if (!file || !line || !column) {
+      ++numWithoutLocation;
+      continue;
+    }
+
+    FunctionExecutionCounts &counts = (*result)[getExecutionProfileKey(
+        file->str(),
+        (unsigned)line->getValue(),
+        (unsigned)column->getValue(),
+        name->str())];
+    uint64_t blockCount = 0;
+    for (const JSONValue *blockVal : *blocks) {
+      auto *block = dyn_cast<JSONObject>(blockVal);
+      auto *count = block
+          ? llvm::dyn_cast_or_null<JSONNumber>(block->get("execution_count"))
+          : nullptr;
+      if (!count) {
+        llvm::errs() << "Invalid basic block in execution profile for "
+                     << name->str() << '\n';
+        return nullptr;
+      }
+      blockCount = count->getValue();
+      counts.maxBlockCount = std::max(counts.maxBlockCount, blockCount);
+    }
+    // The entry block has the largest profile index, so it comes last.
+    counts.entryCount += blockCount;
+  }
+  if (numWithoutLocation) {
+    llvm::errs() << "warning: ignoring " << numWithoutLocation
+                 << " function(s) without a source location in the execution "
+                    "profile, compile the profiled bytecode with -g\n";
+  }
+  return result;
+}
+
 /// Read a resolution table. Given a file name, it maps every require string
 /// to the actual file which must be required.
 /// Prints out error messages to stderr in case of failure.
@@ -1956,8 +2099,17 @@ CompileResult compileFromCommandLineOptions() {
         "validateFlags() should enforce exactly one bytecode input file");
     return processBytecodeFile(std::move(fileBufs[0][0].file));
   } else {
-    std::shared_ptr<Context> context =
-        createContext(std::move(resolutionTable), std::move(segmentRanges));
+    std::shared_ptr<const ExecutionProfile> inliningProfile = nullptr;
+    if (!cl::InliningProfile.empty()) {
+      inliningProfile = readExecutionProfile(cl::InliningProfile);
+      if (!inliningProfile)
+        return InputFileError;
+    }
+
+    std::shared_ptr<Context> context = createContext(
+        std::move(resolutionTable),
+        std::move(segmentRanges),
+        std::move(inliningProfile));
     return processSourceFiles(context, std::move(fileBufs));
   }
 }
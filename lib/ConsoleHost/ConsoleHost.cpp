@@ -438,7 +438,7 @@ bool executeHBCBytecodeImpl(
 
 #ifdef HERMESVM_PROFILER_BB
   if (options.basicBlockProfiling) {
-    runtime->getBasicBlockExecutionInfo().dump(llvm::errs());
+    runtime->dumpBasicBlockProfileTrace(llvm::errs());
   }
 #endif
 
@@ -60,6 +60,10 @@ void hermes::runFullOptimizationPasses(Module &M) {
   PM.addStackPromotion();
   PM.addInlining();
   PM.addStackPromotion();
+  // Replace the literals which don't escape, now that inlining has exposed
+  // more of them, and promote their properties to registers.
+  PM.addScalarReplacement();
+  PM.addMem2Reg();
   PM.addInstSimplify();
   PM.addDCE();
 
@@ -10,6 +10,7 @@
 
 #include "hermes/IR/CFG.h"
 #include "hermes/IR/IRBuilder.h"
+#include "hermes/Optimizer/Scalar/SimpleCallGraphProvider.h"
 #include "hermes/Optimizer/Scalar/Utils.h"
 #include "hermes/Support/Statistic.h"
 
@@ -20,6 +21,13 @@ using llvm::dyn_cast;
 using llvm::isa;
 
 STATISTIC(NumInlinedCalls, "Number of inlined calls");
+STATISTIC(
+    NumInlinedMultiCalls,
+    "Number of inlined calls to functions with multiple call sites");
+STATISTIC(NumColdCalls, "Number of calls not inlined because they are cold");
+STATISTIC(
+    NumOverBudgetCalls,
+    "Number of calls not inlined because of the code size budget");
 
 namespace hermes {
 
@@ -261,10 +269,45 @@ static Value *inlineFunction(
   return returnValue ? returnValue : cast<Value>(builder.getLiteralUndefined());
 }
 
-bool Inlining::runOnModule(Module *M) {
-  if (!M->getContext().getOptimizationSettings().inlining)
-    return false;
+/// Inline the function \p FC into the call site \p CI, replacing the call.
+static void inlineCallSite(Module *M, CallInst *CI, Function *FC) {
+  Function *intoFunction = CI->getParent()->getParent();
+
+  LLVM_DEBUG(llvm::dbgs() << "Inlining function '" << FC->getInternalNameStr()
+                          << "' ";
+             FC->getContext().getSourceErrorManager().dumpCoords(
+                 llvm::dbgs(), FC->getSourceRange().Start);
+             llvm::dbgs() << " into function '"
+                          << intoFunction->getInternalNameStr() << "' ";
+             FC->getContext().getSourceErrorManager().dumpCoords(
+                 llvm::dbgs(), intoFunction->getSourceRange().Start);
+             llvm::dbgs() << "\n";);
+
+  IRBuilder builder(M);
+
+  // Split the block in two and move all instructions following the call
+  // to the new block.
+  BasicBlock *nextBlock = builder.createBasicBlock(intoFunction);
+  builder.setInsertionBlock(nextBlock);
+
+  // Move the rest of the instructions.
+  auto it = CI->getIterator();
+  ++it; // Skip over the call.
+  auto e = CI->getParent()->end();
+  while (it != e)
+    builder.transferInstructionToCurrentBlock(&*it++);
+
+  // Perform the inlining.
+  builder.setInsertionPointAfter(CI);
+
+  auto *returnValue = inlineFunction(builder, FC, CI, nextBlock);
+  CI->replaceAllUsesWith(returnValue);
+  CI->eraseFromParent();
+}
 
+/// Inline all functions which are used exactly once by a direct call.
+/// \return true if anything was inlined.
+static bool inlineSingleUseFunctions(Module *M) {
   bool changed = false;
 
   for (Function &F : *M) {
@@ -285,42 +328,11 @@ bool Inlining::runOnModule(Module *M) {
       if (!isDirectCallee(CFI, CI))
         continue;
 
-      Function *intoFunction = CI->getParent()->getParent();
-
       auto *FC = CFI->getFunctionCode();
-      if (!canBeInlined(FC, intoFunction))
+      if (!canBeInlined(FC, CI->getParent()->getParent()))
         continue;
 
-      LLVM_DEBUG(llvm::dbgs() << "Inlining function '"
-                              << FC->getInternalNameStr() << "' ";
-                 FC->getContext().getSourceErrorManager().dumpCoords(
-                     llvm::dbgs(), FC->getSourceRange().Start);
-                 llvm::dbgs() << " into function '"
-                              << intoFunction->getInternalNameStr() << "' ";
-                 FC->getContext().getSourceErrorManager().dumpCoords(
-                     llvm::dbgs(), intoFunction->getSourceRange().Start);
-                 llvm::dbgs() << "\n";);
-
-      IRBuilder builder(M);
-
-      // Split the block in two and move all instructions following the call
-      // to the new block.
-      BasicBlock *nextBlock = builder.createBasicBlock(intoFunction);
-      builder.setInsertionBlock(nextBlock);
-
-      // Move the rest of the instructions.
-      auto it = CI->getIterator();
-      ++it; // Skip over the call.
-      auto e = CI->getParent()->end();
-      while (it != e)
-        builder.transferInstructionToCurrentBlock(&*it++);
-
-      // Perform the inlining.
-      builder.setInsertionPointAfter(CI);
-
-      auto *returnValue = inlineFunction(builder, FC, CI, nextBlock);
-      CI->replaceAllUsesWith(returnValue);
-      CI->eraseFromParent();
+      inlineCallSite(M, CI, FC);
 
       ++NumInlinedCalls;
       changed = true;
@@ -330,6 +342,185 @@ bool Inlining::runOnModule(Module *M) {
   return changed;
 }
 
+/// \return the number of instructions in the reachable blocks of \p F.
+static unsigned getFunctionSize(Function *F) {
+  unsigned size = 0;
+  for (BasicBlock *BB : orderDFS(F))
+    size += BB->getInstList().size();
+  return size;
+}
+
+/// \return the execution counts of \p F in \p profile, or nullptr if the
+///   function does not appear in it, meaning that it was never executed.
+static const FunctionExecutionCounts *getExecutionCounts(
+    const ExecutionProfile &profile,
+    Function *F) {
+  // Look up the function by its start, the same way the bytecode generator
+  // records it in the debug info.
+  SourceErrorManager &sm = F->getContext().getSourceErrorManager();
+  SourceErrorManager::SourceCoords coords{};
+  if (!sm.findBufferLineAndLoc(
+          F->getSourceRange().Start, coords, /* translate */ true)) {
+    return nullptr;
+  }
+  auto it = profile.find(getExecutionProfileKey(
+      sm.getSourceUrl(coords.bufId),
+      coords.line,
+      coords.col,
+      F->getOriginalOrInferredName().str()));
+  return it == profile.end() ? nullptr : &it->second;
+}
+
+namespace {
+/// A call site which the cost model considers for inlining.
+struct CallSiteCandidate {
+  /// The call to be replaced.
+  CallInst *call;
+  /// The function being called.
+  Function *callee;
+  /// The number of instructions in the callee.
+  unsigned size;
+  /// Estimated number of times the call is executed. Zero if there is no
+  /// profile.
+  uint64_t count;
+};
+} // namespace
+
+/// Inline small functions into their call sites, even when they are called
+/// from more than one place, as long as the growth of the module stays within
+/// a budget. When an execution profile is available, only call sites which
+/// were executed are inlined, and larger functions are inlined into hot call
+/// sites. The hottest call sites and the smallest functions get inlined first.
+/// \return true if anything was inlined.
+static bool inlineMultipleCallSites(Module *M) {
+  const InliningSettings &settings =
+      M->getContext().getOptimizationSettings().inliningSettings;
+  const ExecutionProfile *profile = settings.profile.get();
+
+  // The smallest budget we allow, so small modules get inlined as well.
+  constexpr unsigned kMinGrowthBudget = 100;
+
+  std::vector<CallSiteCandidate> candidates{};
+  // Number of call sites of every candidate function which are not inlined
+  // yet.
+  llvm::DenseMap<Function *, unsigned> remainingCallSites{};
+  unsigned moduleSize = 0;
+
+  for (Function &F : *M) {
+    for (BasicBlock &BB : F)
+      moduleSize += BB.getInstList().size();
+
+    // We need all call sites to be known, so the function can be deleted once
+    // it has been inlined everywhere.
+    SimpleCallGraphProvider cgp(&F);
+    if (cgp.hasUnknownCallsites(&F) || cgp.getKnownCallsites(&F).empty())
+      continue;
+
+    const FunctionExecutionCounts *calleeCounts = nullptr;
+    if (profile) {
+      calleeCounts = getExecutionCounts(*profile, &F);
+      if (!calleeCounts || !calleeCounts->entryCount) {
+        NumColdCalls += cgp.getKnownCallsites(&F).size();
+        continue;
+      }
+    }
+
+    unsigned size = getFunctionSize(&F);
+    if (size > settings.maxHotCalleeSize)
+      continue;
+
+    remainingCallSites[&F] = cgp.getKnownCallsites(&F).size();
+
+    // Visit the call sites in IR order, so the result is deterministic.
+    for (Instruction *I : F.getUsers()) {
+      auto *CFI = llvm::dyn_cast<CreateFunctionInst>(I);
+      if (!CFI)
+        continue;
+      Function *intoFunction = CFI->getParent()->getParent();
+      for (Instruction *U : CFI->getUsers()) {
+        // Constructor calls can't be inlined.
+        if (U->getKind() != ValueKind::CallInstKind)
+          continue;
+        auto *CI = cast<CallInst>(U);
+        // Only inline into the function creating the closure, which is where
+        // the callee's frame variables are accessible from.
+        if (CI->getParent()->getParent() != intoFunction)
+          continue;
+        if (!canBeInlined(&F, intoFunction))
+          continue;
+
+        uint64_t count = 0;
+        unsigned maxSize = settings.maxCalleeSize;
+        if (profile) {
+          // A call can't execute more often than the hottest block of its
+          // caller, nor more often than the callee was invoked.
+          const FunctionExecutionCounts *callerCounts =
+              getExecutionCounts(*profile, intoFunction);
+          if (!callerCounts || !callerCounts->maxBlockCount) {
+            ++NumColdCalls;
+            continue;
+          }
+          count =
+              std::min(callerCounts->maxBlockCount, calleeCounts->entryCount);
+          if (count >= settings.hotCallCount)
+            maxSize = settings.maxHotCalleeSize;
+        }
+        if (size > maxSize)
+          continue;
+
+        candidates.push_back({CI, &F, size, count});
+      }
+    }
+  }
+
+  std::stable_sort(
+      candidates.begin(),
+      candidates.end(),
+      [](const CallSiteCandidate &a, const CallSiteCandidate &b) {
+        if (a.count != b.count)
+          return a.count > b.count;
+        return a.size < b.size;
+      });
+
+  int64_t budget = std::max<int64_t>(
+      (uint64_t)moduleSize * settings.maxGrowthPercent / 100,
+      kMinGrowthBudget);
+
+  bool changed = false;
+  for (const CallSiteCandidate &candidate : candidates) {
+    if (candidate.size > budget) {
+      ++NumOverBudgetCalls;
+      continue;
+    }
+
+    inlineCallSite(M, candidate.call, candidate.callee);
+    budget -= candidate.size;
+
+    // Once the function has been inlined everywhere, its body will be
+    // deleted, so we get its size back.
+    if (--remainingCallSites[candidate.callee] == 0)
+      budget += candidate.size;
+
+    ++NumInlinedCalls;
+    ++NumInlinedMultiCalls;
+    changed = true;
+  }
+
+  return changed;
+}
+
+bool Inlining::runOnModule(Module *M) {
+  const OptimizationSettings &settings =
+      M->getContext().getOptimizationSettings();
+  if (!settings.inlining)
+    return false;
+
+  bool changed = inlineSingleUseFunctions(M);
+  if (settings.inliningSettings.multipleCallSites)
+    changed |= inlineMultipleCallSites(M);
+  return changed;
+}
+
 Pass *createInlining() {
   return new Inlining();
 }
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+//===----------------------------------------------------------------------===//
+/// \file
+/// Scalar replacement of object and array literals.
+///
+/// A literal which is only used as the target of property loads and stores in
+/// its own function can never be observed by anything else, so it doesn't need
+/// to be allocated at all. Every property of such a literal is replaced with a
+/// stack allocation, which Mem2Reg then promotes to SSA values, the same way
+/// StackPromotion handles frame variables.
+///
+/// Only the properties initialized by the literal itself may be accessed:
+/// anything else might be found on the prototype chain, or, for arrays, change
+/// the length. Since the literal is fully initialized before any code can
+/// observe it, every later access reads a property which is already set.
+//===----------------------------------------------------------------------===//
+
+#define DEBUG_TYPE "scalarreplacement"
+
+#include "hermes/Optimizer/Scalar/ScalarReplacement.h"
+#include "hermes/IR/IRBuilder.h"
+#include "hermes/IR/Instrs.h"
+#include "hermes/Support/Statistic.h"
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/Debug.h"
+
+using namespace hermes;
+using llvm::dbgs;
+using llvm::dyn_cast;
+using llvm::isa;
+
+STATISTIC(NumObjectsReplaced, "Number of object literals replaced by scalars");
+STATISTIC(NumArraysReplaced, "Number of array literals replaced by scalars");
+
+/// Literals with more properties than this are unlikely to be temporaries, and
+/// would use too many registers.
+static constexpr unsigned kMaxProperties = 16;
+
+namespace {
+
+/// The properties of a literal which doesn't escape.
+struct LiteralProperties {
+  /// The properties initialized by the literal, in order of initialization.
+  llvm::SmallVector<Literal *, 4> keys{};
+  /// The loads of the "length" of an array literal.
+  llvm::SmallVector<LoadPropertyInst *, 2> lengthLoads{};
+};
+
+} // namespace
+
+/// \return the property \p prop as a key we can track, or nullptr if it isn't
+///   a constant we can track. Every property must have a single key, so
+///   numbers are only tracked if they are uint32, and strings only if they
+///   aren't the name of a uint32 number.
+static Literal *getKey(Value *prop) {
+  if (auto *num = dyn_cast<LiteralNumber>(prop))
+    return num->isUInt32Representible() ? num : nullptr;
+  if (auto *str = dyn_cast<LiteralString>(prop)) {
+    llvm::StringRef name = str->getValue().str();
+    uint64_t index;
+    if (!name.getAsInteger(10, index) && index <= UINT32_MAX &&
+        std::to_string(index) == name)
+      return nullptr;
+    return str;
+  }
+  return nullptr;
+}
+
+/// \return true if \p key is the "length" of an array.
+static bool isLengthKey(Literal *key) {
+  auto *str = dyn_cast<LiteralString>(key);
+  return str && str->getValue().str() == "length";
+}
+
+/// Check whether the literal \p alloc can be replaced by scalars, and collect
+/// its properties into \p props.
+/// \return false if the literal escapes or is used in any other way than
+///   loading and storing its own properties.
+static bool collectProperties(Instruction *alloc, LiteralProperties &props) {
+  Module *M = alloc->getParent()->getParent()->getParent();
+  auto *array = dyn_cast<AllocArrayInst>(alloc);
+  if (array) {
+    for (unsigned i = 0, e = array->getElementCount(); i < e; ++i)
+      props.keys.push_back(M->getLiteralNumber(i));
+  }
+
+  llvm::SmallVector<Literal *, 4> accessed{};
+  for (auto *U : alloc->getUsers()) {
+    if (auto *SOP = dyn_cast<StoreOwnPropertyInst>(U)) {
+      Literal *key = getKey(SOP->getProperty());
+      if (SOP->getObject() != alloc || SOP->getStoredValue() == alloc || !key)
+        return false;
+      if (std::find(props.keys.begin(), props.keys.end(), key) ==
+          props.keys.end())
+        props.keys.push_back(key);
+      continue;
+    }
+    if (auto *SPI = dyn_cast<StorePropertyInst>(U)) {
+      Literal *key = getKey(SPI->getProperty());
+      if (SPI->getObject() != alloc || SPI->getStoredValue() == alloc || !key)
+        return false;
+      accessed.push_back(key);
+      continue;
+    }
+    if (auto *LPI = dyn_cast<LoadPropertyInst>(U)) {
+      Literal *key = getKey(LPI->getProperty());
+      if (LPI->getObject() != alloc || !key)
+        return false;
+      if (array && isLengthKey(key)) {
+        props.lengthLoads.push_back(LPI);
+        continue;
+      }
+      accessed.push_back(key);
+      continue;
+    }
+    // Any other use lets the object escape.
+    return false;
+  }
+
+  if (props.keys.size() > kMaxProperties)
+    return false;
+
+  // Setting "__proto__" in a literal changes the prototype rather than
+  // defining a property.
+  for (Literal *key : props.keys) {
+    auto *str = dyn_cast<LiteralString>(key);
+    if (str && str->getValue().str() == "__proto__")
+      return false;
+  }
+
+  // All accesses must be to properties initialized by the literal.
+  for (Literal *key : accessed) {
+    if (std::find(props.keys.begin(), props.keys.end(), key) ==
+        props.keys.end())
+      return false;
+  }
+
+  // The elements of an array must be dense, so we know its length.
+  if (array) {
+    for (Literal *key : props.keys) {
+      auto *num = dyn_cast<LiteralNumber>(key);
+      if (!num || !num->isUInt32Representible() ||
+          num->asUInt32() >= props.keys.size())
+        return false;
+    }
+    if (array->getSizeHint()->getValue() != props.keys.size())
+      return false;
+  }
+
+  return true;
+}
+
+/// Replace the literal \p alloc, whose properties are \p props, with one stack
+/// allocation per property.
+static void replaceWithScalars(Instruction *alloc, LiteralProperties &props) {
+  Function *F = alloc->getParent()->getParent();
+  IRBuilder builder(F);
+  IRBuilder::InstructionDestroyer destroyer;
+
+  // Allocate the stack locations at the start of the function.
+  llvm::DenseMap<Literal *, AllocStackInst *> slots{};
+  BasicBlock &entry = F->front();
+  builder.setInsertionPoint(&*entry.begin());
+  for (Literal *key : props.keys) {
+    llvm::SmallString<16> name{"?prop_"};
+    if (auto *str = dyn_cast<LiteralString>(key))
+      name += str->getValue().str();
+    else
+      name += std::to_string(cast<LiteralNumber>(key)->asUInt32());
+    slots[key] = builder.createAllocStackInst(name);
+  }
+
+  // The literal elements of an array are operands of the allocation.
+  if (auto *array = dyn_cast<AllocArrayInst>(alloc)) {
+    builder.setInsertionPointAfter(alloc);
+    for (unsigned i = 0, e = array->getElementCount(); i < e; ++i) {
+      builder.createStoreStackInst(
+          array->getArrayElement(i),
+          slots[builder.getLiteralNumber(i)]);
+    }
+    Value *length = builder.getLiteralNumber(props.keys.size());
+    for (LoadPropertyInst *LPI : props.lengthLoads)
+      LPI->replaceAllUsesWith(length);
+  }
+
+  for (auto *U : alloc->getUsers()) {
+    destroyer.add(U);
+    if (std::find(props.lengthLoads.begin(), props.lengthLoads.end(), U) !=
+        props.lengthLoads.end())
+      continue;
+    builder.setInsertionPoint(U);
+    if (auto *SOP = dyn_cast<StoreOwnPropertyInst>(U)) {
+      builder.createStoreStackInst(
+          SOP->getStoredValue(), slots[getKey(SOP->getProperty())]);
+    } else if (auto *SPI = dyn_cast<StorePropertyInst>(U)) {
+      builder.createStoreStackInst(
+          SPI->getStoredValue(), slots[getKey(SPI->getProperty())]);
+    } else {
+      auto *LPI = cast<LoadPropertyInst>(U);
+      LPI->replaceAllUsesWith(
+          builder.createLoadStackInst(slots[getKey(LPI->getProperty())]));
+    }
+  }
+  destroyer.add(alloc);
+}
+
+bool ScalarReplacement::runOnFunction(Function *F) {
+  llvm::SmallVector<std::pair<Instruction *, LiteralProperties>, 4> literals{};
+
+  for (auto &BB : *F) {
+    for (auto &I : BB) {
+      if (!isa<AllocObjectInst>(&I) && !isa<AllocArrayInst>(&I))
+        continue;
+      LiteralProperties props{};
+      if (collectProperties(&I, props))
+        literals.emplace_back(&I, std::move(props));
+    }
+  }
+
+  for (auto &entry : literals) {
+    LLVM_DEBUG(
+        dbgs() << "Replacing " << entry.first->getKindStr() << " with "
+               << entry.second.keys.size() << " scalars in function "
+               << F->getInternalNameStr() << "\n");
+    if (isa<AllocArrayInst>(entry.first))
+      ++NumArraysReplaced;
+    else
+      ++NumObjectsReplaced;
+    replaceWithScalars(entry.first, entry.second);
+  }
+
+  return !literals.empty();
+}
+
+Pass *hermes::createScalarReplacement() {
+  return new ScalarReplacement();
+}
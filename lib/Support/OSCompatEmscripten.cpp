@@ -191,10 +191,21 @@ bool vm_madvise(void *p, size_t sz, MAdvice advice) {
   return true;
 }
 
+bool vm_prefer_numa_node(void *p, size_t sz, int node) {
+  // Not yet supported.
+  return false;
+}
+
 int pages_in_ram(const void *p, size_t sz, llvm::SmallVectorImpl<int> *runs) {
   return -1;
 }
 
+int64_t huge_pages_in_ram(
+    llvm::ArrayRef<std::pair<const void *, size_t>> regions) {
+  // Not yet supported.
+  return -1;
+}
+
 uint64_t peak_rss() {
   return 0;
 }
@@ -253,6 +264,11 @@ int sched_getcpu() {
   return -1;
 }
 
+int numa_node() {
+  // Not yet supported.
+  return -1;
+}
+
 bool set_env(const char *name, const char *value) {
   // Enforce the contract of this function that value must not be empty
   assert(*value != '\0' && "value cannot be empty string");
@@ -273,10 +273,48 @@ bool vm_madvise(void *p, size_t sz, MAdvice advice) {
     case MAdvice::Sequential:
       param = MADV_SEQUENTIAL;
       break;
+    case MAdvice::HugePage:
+#ifdef MADV_HUGEPAGE
+      param = MADV_HUGEPAGE;
+      break;
+#else
+      return false;
+#endif
   }
   return madvise(p, sz, param) == 0;
 }
 
+bool vm_prefer_numa_node(void *p, size_t sz, int node) {
+  assert(
+      reinterpret_cast<intptr_t>(p) % page_size() == 0 &&
+      "Precondition: pointer is page-aligned.");
+#if defined(__linux__) && defined(SYS_mbind)
+  // Use the system call directly rather than libnuma, which isn't always
+  // available. MPOL_PREFERRED is 1 in <linux/mempolicy.h>.
+  constexpr int kMPolPreferred = 1;
+  constexpr int kBitsPerWord = sizeof(unsigned long) * 8;
+  unsigned long nodeMask[16] = {};
+  if (node < 0 || node >= kBitsPerWord * 16) {
+    return false;
+  }
+  nodeMask[node / kBitsPerWord] = 1ul << (node % kBitsPerWord);
+  // The kernel reads one bit less than maxnode.
+  return syscall(
+             SYS_mbind,
+             p,
+             sz,
+             kMPolPreferred,
+             nodeMask,
+             kBitsPerWord * 16 + 1,
+             0) == 0;
+#else
+  (void)p;
+  (void)sz;
+  (void)node;
+  return false;
+#endif
+}
+
 int pages_in_ram(const void *p, size_t sz, llvm::SmallVectorImpl<int> *runs) {
   const auto PS = page_size();
   {
@@ -316,6 +354,62 @@ int pages_in_ram(const void *p, size_t sz, llvm::SmallVectorImpl<int> *runs) {
   return totalIn;
 }
 
+int64_t huge_pages_in_ram(
+    llvm::ArrayRef<std::pair<const void *, size_t>> regions) {
+#if defined(__linux__)
+  FILE *fp = fopen("/proc/self/smaps", "r");
+  if (!fp) {
+    return -1;
+  }
+  static const char kPrefix[] = "AnonHugePages:";
+  constexpr size_t kPrefixLen = sizeof(kPrefix) - 1;
+  // The first region which may overlap the current mapping.
+  size_t firstRegion = 0;
+  // Bytes of the current mapping which are covered by regions.
+  uint64_t overlap = 0;
+  int64_t sum = 0;
+  bool atLineStart = true;
+  char buf[128]; // Just needs to fit the lines we care about.
+  while (fgets(buf, sizeof(buf), fp)) {
+    bool lineStart = atLineStart;
+    atLineStart = strchr(buf, '\n') != nullptr;
+    if (!lineStart) {
+      // The rest of a long line, like the path of a mapped file.
+      continue;
+    }
+    unsigned long start, end;
+    // Mappings start with their address range in lowercase hex, while the
+    // fields describing them start with a capitalized name.
+    if (!isupper(buf[0]) && sscanf(buf, "%lx-%lx", &start, &end) == 2) {
+      while (firstRegion < regions.size() &&
+             reinterpret_cast<uintptr_t>(regions[firstRegion].first) +
+                     regions[firstRegion].second <=
+                 start) {
+        ++firstRegion;
+      }
+      overlap = 0;
+      for (size_t i = firstRegion; i < regions.size(); ++i) {
+        uintptr_t regionStart =
+            reinterpret_cast<uintptr_t>(regions[i].first);
+        if (regionStart >= end) {
+          break;
+        }
+        uintptr_t regionEnd = regionStart + regions[i].second;
+        overlap += std::min<uintptr_t>(regionEnd, end) -
+            std::max<uintptr_t>(regionStart, start);
+      }
+    } else if (overlap && strncmp(buf, kPrefix, kPrefixLen) == 0) {
+      sum += std::min<uint64_t>(atoll(buf + kPrefixLen) * 1024, overlap);
+    }
+  }
+  fclose(fp);
+  return sum;
+#else
+  (void)regions;
+  return -1;
+#endif
+}
+
 uint64_t peak_rss() {
   rusage ru;
   if (getrusage(RUSAGE_SELF, &ru)) {
@@ -551,6 +645,18 @@ std::vector<bool> sched_getaffinity() {
 int sched_getcpu() {
   return ::sched_getcpu();
 }
+
+int numa_node() {
+#ifdef SYS_getcpu
+  unsigned cpu, node;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+    return -1;
+  }
+  return node;
+#else
+  return -1;
+#endif
+}
 #else
 std::vector<bool> sched_getaffinity() {
   // Not yet supported.
@@ -561,6 +667,11 @@ int sched_getcpu() {
   // Not yet supported.
   return -1;
 }
+
+int numa_node() {
+  // Not yet supported.
+  return -1;
+}
 #endif
 
 bool set_env(const char *name, const char *value) {
@@ -309,11 +309,22 @@ bool vm_madvise(void *p, size_t sz, MAdvice advice) {
   return false;
 }
 
+bool vm_prefer_numa_node(void *p, size_t sz, int node) {
+  // Not yet supported.
+  return false;
+}
+
 int pages_in_ram(const void *p, size_t sz, llvm::SmallVectorImpl<int> *runs) {
   // Not yet supported.
   return -1;
 }
 
+int64_t huge_pages_in_ram(
+    llvm::ArrayRef<std::pair<const void *, size_t>> regions) {
+  // Not yet supported.
+  return -1;
+}
+
 uint64_t peak_rss() {
   PROCESS_MEMORY_COUNTERS pmc;
   auto ret = GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc));
@@ -406,6 +417,11 @@ int sched_getcpu() {
   return -1;
 }
 
+int numa_node() {
+  // Not yet supported.
+  return -1;
+}
+
 bool set_env(const char *name, const char *value) {
   // Setting an env var to empty requires a lot of hacks on Windows
   assert(*value != '\0' && "value cannot be empty string");
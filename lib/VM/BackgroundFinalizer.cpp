@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/VM/BackgroundFinalizer.h"
+
+#include <chrono>
+
+namespace hermes {
+namespace vm {
+
+BackgroundFinalizer::BackgroundFinalizer()
+    : thread_(&BackgroundFinalizer::run, this) {}
+
+BackgroundFinalizer::~BackgroundFinalizer() {
+  submit();
+  {
+    std::lock_guard<std::mutex> lk{mutex_};
+    stop_ = true;
+  }
+  workAvailable_.notify_one();
+  thread_.join();
+}
+
+void BackgroundFinalizer::submit() {
+  if (batch_.empty()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lk{mutex_};
+    if (queue_.empty()) {
+      queue_.swap(batch_);
+    } else {
+      queue_.insert(queue_.end(), batch_.begin(), batch_.end());
+      batch_.clear();
+    }
+  }
+  workAvailable_.notify_one();
+}
+
+void BackgroundFinalizer::drain() {
+  submit();
+  std::unique_lock<std::mutex> lk{mutex_};
+  idle_.wait(lk, [this] { return queue_.empty() && !busy_; });
+}
+
+uint64_t BackgroundFinalizer::numReleased() {
+  std::lock_guard<std::mutex> lk{mutex_};
+  return numReleased_;
+}
+
+double BackgroundFinalizer::releaseSecs() {
+  std::lock_guard<std::mutex> lk{mutex_};
+  return releaseSecs_;
+}
+
+void BackgroundFinalizer::run() {
+  std::vector<Release> work;
+  std::unique_lock<std::mutex> lk{mutex_};
+  while (true) {
+    workAvailable_.wait(lk, [this] { return !queue_.empty() || stop_; });
+    if (queue_.empty()) {
+      // stop_ is set, and everything has been released.
+      return;
+    }
+    work.swap(queue_);
+    busy_ = true;
+    lk.unlock();
+
+    auto start = std::chrono::steady_clock::now();
+    for (const Release &r : work) {
+      r.release(r.context);
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    lk.lock();
+    numReleased_ += work.size();
+    releaseSecs_ += elapsed.count();
+    work.clear();
+    busy_ = false;
+    if (queue_.empty()) {
+      idle_.notify_all();
+    }
+  }
+}
+
+} // namespace vm
+} // namespace hermes
@@ -44,7 +44,7 @@ static llvm::MD5::MD5Result doMD5Checksum(llvm::ArrayRef<uint8_t> bytecode) {
   return checksum;
 }
 
-void BasicBlockExecutionInfo::dump(llvm::raw_ostream &OS) {
+void BasicBlockExecutionInfo::dump(llvm::raw_ostream &OS, Runtime *runtime) {
   JSONEmitter json(OS);
   json.openDict();
   json.emitKeyValue("version", BASIC_BLOCK_STAT_VERSION);
@@ -57,6 +57,22 @@ void BasicBlockExecutionInfo::dump(llvm::raw_ostream &OS) {
     json.openDict();
     auto md5Result = doMD5Checksum(funcEntry.first->getOpcodeArray());
     json.emitKeyValue("checksum", md5Result.digest().str());
+    json.emitKeyValue(
+        "name",
+        funcEntry.first->getNameString(runtime->getHeap().getCallbacks()));
+    // The source location lets the compiler match the profile to the
+    // functions in the source, since the checksum changes whenever the
+    // bytecode does. It is only known when the bytecode has debug info.
+    if (auto debugOffset = funcEntry.first->getDebugSourceLocationsOffset()) {
+      auto *debugInfo =
+          funcEntry.first->getRuntimeModule()->getBytecode()->getDebugInfo();
+      if (auto location = debugInfo->getLocationForFunction(*debugOffset)) {
+        json.emitKeyValue(
+            "file", debugInfo->getFilenameByID(location->filenameId));
+        json.emitKeyValue("line", location->line);
+        json.emitKeyValue("column", location->column);
+      }
+    }
 
     // hbcdump will be responsible to check overflow scenario(index-zero entry
     // is not empty).
@@ -339,6 +339,75 @@ CallResult<PseudoHandle<>> Callable::executeCall4(
   return call(selfHandle, runtime);
 }
 
+PreparedCall::PreparedCall(
+    Runtime *runtime,
+    Handle<Callable> callee,
+    uint32_t argCount)
+    : runtime_(runtime),
+      callee_(callee),
+      codeBlock_(
+          vmisa<JSFunction>(callee.get())
+              ? vmcast<JSFunction>(callee.get())->getCodeBlock()
+              : nullptr) {
+  // Other callables, such as bound functions, may rewrite the whole frame, so
+  // they get a new one on every call.
+  if (!codeBlock_)
+    return;
+  frame_.emplace(
+      runtime,
+      argCount,
+      callee.get(),
+      false,
+      HermesValue::encodeUndefinedValue());
+  if (LLVM_UNLIKELY(frame_->overflowed()))
+    return;
+  // The arguments are only set by call(), but the frame may be scanned by the
+  // GC before that.
+  frame_->fillArguments(argCount, HermesValue::encodeUndefinedValue());
+  codeBlock_->lazyCompile(runtime);
+}
+
+CallResult<PseudoHandle<>> PreparedCall::call(
+    Handle<> thisArg,
+    llvm::ArrayRef<HermesValue> args) {
+  if (LLVM_UNLIKELY(!codeBlock_)) {
+    ScopedNativeCallFrame newFrame{runtime_,
+                                   static_cast<uint32_t>(args.size()),
+                                   callee_.get(),
+                                   false,
+                                   *thisArg};
+    if (LLVM_UNLIKELY(newFrame.overflowed()))
+      return runtime_->raiseStackOverflow(
+          Runtime::StackOverflowKind::NativeStack);
+    for (uint32_t i = 0, e = args.size(); i != e; ++i)
+      newFrame->getArgRef(i) = args[i];
+    return Callable::call(callee_, runtime_);
+  }
+
+  ScopedNativeCallFrame &frame = *frame_;
+  if (LLVM_UNLIKELY(frame.overflowed()))
+    return runtime_->raiseStackOverflow(
+        Runtime::StackOverflowKind::NativeStack);
+  // The callee may have overwritten its arguments and this in the previous
+  // call, so all of them are stored again.
+  assert(args.size() == frame->getArgCount() && "Arg count mismatch");
+  frame->getThisArgRef() = *thisArg;
+  for (uint32_t i = 0, e = args.size(); i != e; ++i)
+    frame->getArgRef(i) = args[i];
+
+  runtime_->potentiallyMoveHeap();
+  CallResult<HermesValue> result{ExecutionStatus::EXCEPTION};
+  if (auto *jitPtr = codeBlock_->getJITCompiled()) {
+    result = (*jitPtr)(runtime_);
+  } else {
+    result = runtime_->interpretFunction(codeBlock_);
+  }
+  if (LLVM_UNLIKELY(result == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  return createPseudoHandle(*result);
+}
+
 CallResult<PseudoHandle<>> Callable::executeCall(
     Handle<Callable> selfHandle,
     Runtime *runtime,
@@ -1285,6 +1354,15 @@ void JSFunction::addLocationToSnapshot(
   }
 }
 
+CallResult<PseudoHandle<JSObject>> JSFunction::_newObjectImpl(
+    Handle<Callable> selfHandle,
+    Runtime *runtime,
+    Handle<JSObject> parentHandle) {
+  auto *codeBlock = vmcast<JSFunction>(selfHandle.get())->getCodeBlock();
+  return JSObject::create(
+      runtime, parentHandle, codeBlock->getConstructedObjectSlots());
+}
+
 CallResult<PseudoHandle<>> JSFunction::_callImpl(
     Handle<Callable> selfHandle,
     Runtime *runtime) {
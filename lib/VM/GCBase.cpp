@@ -17,12 +17,14 @@
 #include "hermes/VM/Runtime.h"
 #include "hermes/VM/VTable.h"
 
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Format.h"
 #include "llvm/Support/NativeFormatting.h"
 #include "llvm/Support/raw_ostream.h"
 
+#include <algorithm>
 #include <inttypes.h>
 #include <stdexcept>
 #include <system_error>
@@ -49,6 +51,7 @@ GCBase::GCBase(
       inGC_(false),
       name_(gcConfig.getName()),
       allocationLocationTracker_(this),
+      samplingAllocationTracker_(this),
       tripwireCallback_(gcConfig.getTripwireConfig().getCallback()),
       tripwireLimit_(gcConfig.getTripwireConfig().getLimit())
 #ifdef HERMESVM_SANITIZE_HANDLES
@@ -68,6 +71,9 @@ GCBase::GCBase(
       gcConfig.getMaxHeapSize() >> 20,
       gcConfig.getTripwireConfig().getLimit() >> 20);
 #endif // HERMESVM_PLATFORM_LOGGING
+  if (gcConfig.getBackgroundFinalization()) {
+    backgroundFinalizer_.reset(new BackgroundFinalizer());
+  }
 #ifdef HERMESVM_SANITIZE_HANDLES
   const std::minstd_rand::result_type seed =
       gcConfig.getSanitizeConfig().getRandomSeed() >= 0
@@ -102,6 +108,10 @@ GCBase::GCCycle::GCCycle(
 }
 
 GCBase::GCCycle::~GCCycle() {
+  if (gc_->backgroundFinalizer_) {
+    // Everything finalized during this collection can now be released.
+    gc_->backgroundFinalizer_->submit();
+  }
   if (gcCallbacksOpt_.hasValue()) {
     gcCallbacksOpt_.getValue()->onGCEvent(
         GCEventKind::CollectionEnd, extraInfo_);
@@ -271,7 +281,16 @@ void GCBase::printStats(llvm::raw_ostream &os, bool trailingComma) {
      << "\t\t\"peakLiveAfterGC\": " << formatSize(getPeakLiveAfterGC()).bytes
      << ",\n"
      << "\t\t\"totalAllocatedBytes\": "
-     << formatSize(info.totalAllocatedBytes).bytes << "\n"
+     << formatSize(info.totalAllocatedBytes).bytes;
+  if (backgroundFinalizer_) {
+    backgroundFinalizer_->drain();
+    os << ",\n"
+       << "\t\t\"backgroundReleases\": "
+       << backgroundFinalizer_->numReleased() << ",\n"
+       << "\t\t\"backgroundReleaseTime\": "
+       << backgroundFinalizer_->releaseSecs();
+  }
+  os << "\n"
      << "\t}";
 
   if (trailingComma) {
@@ -280,6 +299,21 @@ void GCBase::printStats(llvm::raw_ostream &os, bool trailingComma) {
   os << "\n";
 }
 
+void GCBase::printHugePageStats(
+    llvm::raw_ostream &os,
+    const StorageProvider &provider) {
+  auto hugePageBytes = provider.hugePageBytes();
+  if (!hugePageBytes) {
+    return;
+  }
+  const size_t liveBytes = provider.numLiveAllocs() * AlignedStorage::size();
+  double coverage = liveBytes
+      ? static_cast<double>(*hugePageBytes) / static_cast<double>(liveBytes)
+      : 0.0;
+  os << "\t\t\t\"hugePageBytes\": " << *hugePageBytes << ",\n"
+     << "\t\t\t\"hugePageCoverage\": " << coverage << ",\n";
+}
+
 void GCBase::recordGCStats(
     double wallTime,
     double cpuTime,
@@ -363,21 +397,6 @@ bool GCBase::shouldSanitizeHandles() {
 }
 #endif
 
-/*static*/
-std::list<detail::WeakRefKey *> GCBase::buildKeyList(
-    GC *gc,
-    JSWeakMap *weakMap) {
-  std::list<detail::WeakRefKey *> res;
-  for (auto iter = weakMap->keys_begin(), end = weakMap->keys_end();
-       iter != end;
-       iter++) {
-    if (iter->getObject(gc)) {
-      res.push_back(&(*iter));
-    }
-  }
-  return res;
-}
-
 WeakRefMutex &GCBase::weakRefMutex() {
   return weakRefMutex_;
 }
@@ -433,6 +452,152 @@ GCBase::IDTracker::IDTracker() {
   assert(nextNativeID_ % 2 == 0 && "First native object ID isn't even");
 }
 
+void GCBase::SamplingAllocationLocationTracker::enable(
+    size_t samplingInterval,
+    int64_t seed) {
+  assert(samplingInterval > 0 && "Sampling interval must be positive");
+  randomEngine_.seed(seed >= 0 ? seed : std::random_device()());
+  dist_ = std::exponential_distribution<double>(1.0 / samplingInterval);
+  bytesUntilSample_ = nextSampleDistance();
+  enabled_ = true;
+}
+
+size_t GCBase::SamplingAllocationLocationTracker::nextSampleDistance() {
+  // Never return zero, as that would sample the very next allocation
+  // regardless of its size.
+  return std::max<size_t>(1, static_cast<size_t>(dist_(randomEngine_)));
+}
+
+void GCBase::SamplingAllocationLocationTracker::sampleAlloc(
+    const void *ptr,
+    uint32_t sz) {
+  bytesUntilSample_ = nextSampleDistance();
+  const auto *ip = gc_->gcCallbacks_->getCurrentIPSlow();
+  StackTracesTreeNode *node =
+      gc_->gcCallbacks_->getCurrentStackTracesTreeNode(ip);
+  if (!node) {
+    // Allocations made outside of the interpreter loop (e.g. during runtime
+    // initialization) are attributed to the root of the tree.
+    StackTracesTree *tree = gc_->gcCallbacks_->getStackTracesTree();
+    if (!tree) {
+      return;
+    }
+    node = tree->getRootNode();
+  }
+  samples_[ptr] = Sample{sz, node, nextSampleID_++};
+}
+
+void GCBase::SamplingAllocationLocationTracker::disable(
+    llvm::raw_ostream &os,
+    const StackTracesTree *stackTracesTree) {
+  enabled_ = false;
+
+  // Aggregate the samples by stack-trace, and find every node of the tree
+  // which is on the path from the root to a sampled node. Only those nodes are
+  // written out.
+  llvm::DenseMap<const StackTracesTreeNode *, uint64_t> selfSizes;
+  llvm::DenseSet<const StackTracesTreeNode *> sampledPaths;
+  std::vector<Sample> samples;
+  samples.reserve(samples_.size());
+  for (const auto &entry : samples_) {
+    const Sample &sample = entry.second;
+    samples.push_back(sample);
+    selfSizes[sample.node] += sample.size;
+    for (const StackTracesTreeNode *node = sample.node;
+         node && sampledPaths.insert(node).second;
+         node = node->parent) {
+    }
+  }
+  samples_.clear();
+  std::sort(
+      samples.begin(), samples.end(), [](const Sample &a, const Sample &b) {
+        return a.id < b.id;
+      });
+
+  const StackTracesTreeNode *root =
+      stackTracesTree ? stackTracesTree->getRootNode() : nullptr;
+  std::shared_ptr<StringSetVector> strings =
+      stackTracesTree ? stackTracesTree->getStringTable() : nullptr;
+
+  JSONEmitter json(os);
+  json.openDict();
+  json.emitKey("head");
+  // Emit the tree depth-first. A nullptr on the stack marks the end of the
+  // children of the node most recently opened.
+  std::vector<const StackTracesTreeNode *> nodeStack;
+  if (root) {
+    nodeStack.push_back(root);
+  } else {
+    // Still write out a well-formed, empty profile.
+    json.openDict();
+    json.emitKey("callFrame");
+    json.openDict();
+    json.emitKeyValue("functionName", "(root)");
+    json.emitKeyValue("scriptId", "0");
+    json.emitKeyValue("url", "");
+    json.emitKeyValue("lineNumber", -1);
+    json.emitKeyValue("columnNumber", -1);
+    json.closeDict();
+    json.emitKeyValue("selfSize", 0);
+    json.emitKeyValue("id", 0);
+    json.emitKey("children");
+    json.openArray();
+    nodeStack.push_back(nullptr);
+  }
+  while (!nodeStack.empty()) {
+    const StackTracesTreeNode *node = nodeStack.back();
+    nodeStack.pop_back();
+    if (!node) {
+      json.closeArray(); // "children"
+      json.closeDict();
+      continue;
+    }
+    json.openDict();
+    json.emitKey("callFrame");
+    json.openDict();
+    if (node == root) {
+      json.emitKeyValue("functionName", "(root)");
+      json.emitKeyValue("scriptId", "0");
+      json.emitKeyValue("url", "");
+    } else {
+      json.emitKeyValue("functionName", (*strings)[node->name]);
+      json.emitKeyValue(
+          "scriptId", std::to_string(node->sourceLoc.scriptName));
+      json.emitKeyValue("url", (*strings)[node->sourceLoc.scriptName]);
+    }
+    // Chrome uses 0-based line and column numbers, we use 1-based ones.
+    json.emitKeyValue(
+        "lineNumber",
+        node->sourceLoc.lineNo > 0 ? node->sourceLoc.lineNo - 1 : -1);
+    json.emitKeyValue(
+        "columnNumber",
+        node->sourceLoc.columnNo > 0 ? node->sourceLoc.columnNo - 1 : -1);
+    json.closeDict(); // "callFrame"
+    json.emitKeyValue("selfSize", selfSizes.lookup(node));
+    json.emitKeyValue("id", node->id);
+    json.emitKey("children");
+    json.openArray();
+    nodeStack.push_back(nullptr);
+    for (const StackTracesTreeNode *child : node->getChildren()) {
+      if (sampledPaths.count(child)) {
+        nodeStack.push_back(child);
+      }
+    }
+  }
+
+  json.emitKey("samples");
+  json.openArray();
+  for (const Sample &sample : samples) {
+    json.openDict();
+    json.emitKeyValue("size", sample.size);
+    json.emitKeyValue("nodeId", sample.node->id);
+    json.emitKeyValue("ordinal", sample.id);
+    json.closeDict();
+  }
+  json.closeArray(); // "samples"
+  json.closeDict();
+}
+
 #ifdef HERMESVM_SERIALIZE
 void GCBase::AllocationLocationTracker::serialize(Serializer &s) const {
   if (enabled_) {
@@ -301,6 +301,14 @@ Handle<HiddenClass> HiddenClass::copyToNewDictionary(
   return newClassHandle;
 }
 
+Handle<HiddenClass> HiddenClass::copyToAlwaysCacheableDictionary(
+    Handle<HiddenClass> selfHandle,
+    Runtime *runtime) {
+  auto newClassHandle = copyToNewDictionary(selfHandle, runtime);
+  newClassHandle->flags_.dictionaryAlwaysCacheable = true;
+  return newClassHandle;
+}
+
 void HiddenClass::forEachPropertyNoAlloc(
     HiddenClass *self,
     PointerBase *base,
@@ -434,9 +442,14 @@ Handle<HiddenClass> HiddenClass::deleteProperty(
     PropertyPos pos) {
   // We convert to dictionary if we're not yet a dictionary
   // (transition to a cacheable dictionary), or if we are, but not yet
-  // in no-cache mode (transition to no-cache mode).
+  // in no-cache mode (transition to no-cache mode, unless the class must
+  // stay cacheable).
   auto newHandle = LLVM_UNLIKELY(!selfHandle->isDictionaryNoCache())
-      ? copyToNewDictionary(selfHandle, runtime, selfHandle->isDictionary())
+      ? copyToNewDictionary(
+            selfHandle,
+            runtime,
+            selfHandle->isDictionary() &&
+                !selfHandle->isDictionaryAlwaysCacheable())
       : selfHandle;
 
   --newHandle->numProperties_;
@@ -625,9 +638,13 @@ Handle<HiddenClass> HiddenClass::updateProperty(
     DictPropertyMap::getDescriptorPair(
         selfHandle->propertyMap_.get(runtime), pos)
         ->second.flags = newFlags;
-    // If it's still cacheable, make it non-cacheable.
+    // If it's still cacheable, make it non-cacheable, or just invalidate the
+    // inline caches referencing it if it must stay cacheable.
     if (!selfHandle->isDictionaryNoCache()) {
-      selfHandle = copyToNewDictionary(selfHandle, runtime, /*noCache*/ true);
+      selfHandle = copyToNewDictionary(
+          selfHandle,
+          runtime,
+          /*noCache*/ !selfHandle->isDictionaryAlwaysCacheable());
     }
     return selfHandle;
   }
@@ -726,6 +743,18 @@ Handle<HiddenClass> HiddenClass::makeAllNonConfigurable(
       dbgs() << "Class:" << selfHandle->getDebugAllocationId()
              << " making all non-configurable\n");
 
+  // updateProperty() copies an always-cacheable dictionary on every call, so
+  // copy it only once here and update the flags of the copy in place.
+  if (selfHandle->isDictionaryAlwaysCacheable()) {
+    auto classHandle = copyToNewDictionary(selfHandle, runtime);
+    DictPropertyMap::forEachMutablePropertyDescriptor(
+        runtime->makeHandle(classHandle->propertyMap_),
+        runtime,
+        [](NamedPropertyDescriptor &desc) { desc.flags.configurable = 0; });
+    classHandle->flags_.allNonConfigurable = true;
+    return classHandle;
+  }
+
   // Keep a handle to our initial map. The order of properties in it will
   // remain the same as long as we are only doing property updates.
   auto mapHandle = runtime->makeHandle(selfHandle->propertyMap_);
@@ -771,6 +800,22 @@ Handle<HiddenClass> HiddenClass::makeAllReadOnly(
       dbgs() << "Class:" << selfHandle->getDebugAllocationId()
              << " making all read-only\n");
 
+  // See makeAllNonConfigurable().
+  if (selfHandle->isDictionaryAlwaysCacheable()) {
+    auto classHandle = copyToNewDictionary(selfHandle, runtime);
+    DictPropertyMap::forEachMutablePropertyDescriptor(
+        runtime->makeHandle(classHandle->propertyMap_),
+        runtime,
+        [](NamedPropertyDescriptor &desc) {
+          if (!desc.flags.accessor)
+            desc.flags.writable = 0;
+          desc.flags.configurable = 0;
+        });
+    classHandle->flags_.allNonConfigurable = true;
+    classHandle->flags_.allReadOnly = true;
+    return classHandle;
+  }
+
   // Keep a handle to our initial map. The order of properties in it will
   // remain the same as long as we are only doing property updates.
   auto mapHandle = runtime->makeHandle(selfHandle->propertyMap_);
@@ -817,7 +862,8 @@ Handle<HiddenClass> HiddenClass::updatePropertyFlagsWithoutTransitions(
     OptValue<llvm::ArrayRef<SymbolID>> props) {
   // Result must be in dictionary mode, since it's a non-empty orphan.
   MutableHandle<HiddenClass> classHandle{runtime};
-  if (selfHandle->isDictionary()) {
+  if (selfHandle->isDictionary() &&
+      !selfHandle->isDictionaryAlwaysCacheable()) {
     classHandle = *selfHandle;
   } else {
     classHandle = *copyToNewDictionary(selfHandle, runtime);
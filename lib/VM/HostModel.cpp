@@ -109,6 +109,15 @@ ObjectVTable HostObject::vt{
     HostObject::_checkAllOwnIndexedImpl,
 };
 
+void HostObject::_finalizeImpl(GCCell *cell, GC *gc) {
+  auto *self = vmcast<HostObject>(cell);
+  // Host objects may be destroyed on any thread.
+  gc->releaseNative(
+      [](void *proxy) { delete static_cast<Decoration *>(proxy); },
+      self->takeDecoration().release());
+  DecoratedObject::_finalizeImpl(cell, gc);
+}
+
 void HostObjectBuildMeta(const GCCell *cell, Metadata::Builder &mb) {
   mb.addJSObjectOverlapSlots(JSObject::numOverlapSlots<HostObject>());
   ObjectBuildMeta(cell, mb);
@@ -31,7 +31,7 @@ IdentifierTable::LookupEntry::LookupEntry(
   assert(str && "Invalid string primitive pointer");
   llvm::SmallVector<char16_t, 32> storage{};
   str->copyUTF16String(storage);
-  hash_ = hermes::hashString(llvm::ArrayRef<char16_t>(storage));
+  hash_ = hermes::runtimeHashString(llvm::ArrayRef<char16_t>(storage));
 }
 
 #ifdef HERMESVM_SERIALIZE
@@ -127,7 +127,7 @@ CallResult<Handle<SymbolID>> IdentifierTable::getSymbolHandle(
 }
 
 SymbolID IdentifierTable::registerLazyIdentifier(ASCIIRef str) {
-  return registerLazyIdentifierImpl(str, hermes::hashString(str));
+  return registerLazyIdentifierImpl(str, hermes::runtimeHashString(str));
 }
 
 SymbolID IdentifierTable::registerLazyIdentifier(ASCIIRef str, uint32_t hash) {
@@ -135,7 +135,7 @@ SymbolID IdentifierTable::registerLazyIdentifier(ASCIIRef str, uint32_t hash) {
 }
 
 SymbolID IdentifierTable::registerLazyIdentifier(UTF16Ref str) {
-  return registerLazyIdentifierImpl(str, hermes::hashString(str));
+  return registerLazyIdentifierImpl(str, hermes::runtimeHashString(str));
 }
 
 SymbolID IdentifierTable::registerLazyIdentifier(UTF16Ref str, uint32_t hash) {
@@ -380,7 +380,7 @@ CallResult<SymbolID> IdentifierTable::getOrCreateIdentifier(
 StringPrimitive *IdentifierTable::getExistingStringPrimitiveOrNull(
     Runtime *runtime,
     llvm::ArrayRef<char16_t> str) {
-  auto idx = hashTable_.lookupString(str, hashString(str));
+  auto idx = hashTable_.lookupString(str, runtimeHashString(str));
   if (!hashTable_.isValid(idx)) {
     return nullptr;
   }
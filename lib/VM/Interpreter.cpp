@@ -16,6 +16,7 @@
 #include "hermes/VM/Callable.h"
 #include "hermes/VM/CodeBlock.h"
 #include "hermes/VM/HandleRootOwner-inline.h"
+#include "hermes/VM/Interpreter-inline.h"
 #include "hermes/VM/JIT/JIT.h"
 #include "hermes/VM/JSArray.h"
 #include "hermes/VM/JSError.h"
@@ -1445,6 +1446,52 @@ tailCall:
       NEXTINST(JNot##name##Long),       \
       IPADD(ip->iJNot##name##Long.op1));
 
+/// Implement a superinstruction which stores the sum or difference of two
+/// numbers and then jumps based on comparing the result with another value.
+/// \param name the name of the instruction.
+/// \param suffix  Optional suffix to be added to the end (e.g. Long)
+/// \param arithOper the C++ operator to use to perform the numeric arithmetic.
+/// \param oper the C++ operator to use to actually perform the fast arithmetic
+///     comparison.
+/// \param operFuncName  function to call for the slow-path comparison.
+#define ARITH_JCOND_IMPL(name, suffix, arithOper, oper, operFuncName) \
+  CASE(name##suffix) {                                                \
+    O2REG(name##suffix) = HermesValue::encodeDoubleValue(             \
+        O3REG(name##suffix).getNumber() arithOper                     \
+            O4REG(name##suffix).getNumber());                         \
+    if (LLVM_LIKELY(O5REG(name##suffix).isNumber())) {                \
+      /* Fast-path. */                                                \
+      if (O2REG(name##suffix)                                         \
+              .getNumber() oper O5REG(name##suffix)                   \
+              .getNumber()) {                                         \
+        ip = IPADD(ip->i##name##suffix.op1);                          \
+        DISPATCH;                                                     \
+      }                                                               \
+      ip = NEXTINST(name##suffix);                                    \
+      DISPATCH;                                                       \
+    }                                                                 \
+    CAPTURE_IP_ASSIGN(                                                \
+        boolRes,                                                      \
+        operFuncName(                                                 \
+            runtime,                                                  \
+            Handle<>(&O2REG(name##suffix)),                           \
+            Handle<>(&O5REG(name##suffix))));                         \
+    if (boolRes == ExecutionStatus::EXCEPTION)                        \
+      goto exception;                                                 \
+    gcScope.flushToSmallCount(KEEP_HANDLES);                          \
+    if (boolRes.getValue()) {                                         \
+      ip = IPADD(ip->i##name##suffix.op1);                            \
+      DISPATCH;                                                       \
+    }                                                                 \
+    ip = NEXTINST(name##suffix);                                      \
+    DISPATCH;                                                         \
+  }
+
+/// Implement the long and short forms of an arithmetic conditional jump.
+#define ARITH_JCOND(name, arithOper, oper, operFuncName)   \
+  ARITH_JCOND_IMPL(name, , arithOper, oper, operFuncName); \
+  ARITH_JCOND_IMPL(name, Long, arithOper, oper, operFuncName)
+
 /// Load a constant.
 /// \param value is the value to store in the output register.
 #define LOAD_CONST(name, value) \
@@ -1864,6 +1911,16 @@ tailCall:
         // Store the return value.
         res = O1REG(Ret);
 
+        // Record how many property slots the constructor filled, so later
+        // objects created for it can be allocated with that much storage.
+        if (LLVM_UNLIKELY(FRAME.isConstructorCall()) &&
+            FRAME.getThisArgRef().isObject()) {
+          curCodeBlock->recordConstructedObjectSlots(
+              vmcast<JSObject>(FRAME.getThisArgRef())
+                  ->getClass(runtime)
+                  ->getNumProperties());
+        }
+
         ip = FRAME.getSavedIP();
         curCodeBlock = FRAME.getSavedCodeBlock();
 
@@ -2367,6 +2424,7 @@ tailCall:
             // Cache the class, id and property slot.
             cacheEntry->clazz = clazzGCPtr.getStorageType();
             cacheEntry->slot = desc.slot;
+            cacheEntry->protoDepth = 0;
           }
 
           CAPTURE_IP_ASSIGN(
@@ -2375,23 +2433,26 @@ tailCall:
           DISPATCH;
         }
 
-        // The cache may also be populated via the prototype of the object.
-        // This value is only reliable if the fast path was a definite
+        // The cache may also be populated via the prototype chain of the
+        // object. This value is only reliable if the fast path was a definite
         // not-found.
         if (fastPathResult.hasValue() && !fastPathResult.getValue() &&
             !obj->isProxyObject()) {
-          CAPTURE_IP_ASSIGN(JSObject * parent, obj->getParent(runtime));
-          // TODO: This isLazy check is because a lazy object is reported as
-          // having no properties and therefore cannot contain the property.
-          // This check does not belong here, it should be merged into
-          // tryGetOwnNamedDescriptorFast().
-          if (parent &&
-              cacheEntry->clazz == parent->getClassGCPtr().getStorageType() &&
-              LLVM_LIKELY(!obj->isLazy())) {
+          // TODO: The isLazy check in getCachedPrototypeHolder() is because a
+          // lazy object is reported as having no properties and therefore
+          // cannot contain the property. This check does not belong there,
+          // it should be merged into tryGetOwnNamedDescriptorFast().
+          CAPTURE_IP_ASSIGN(
+              JSObject * holder,
+              getCachedPrototypeHolder(runtime, obj, id, cacheEntry));
+          if (holder) {
             ++NumGetByIdProtoHits;
+#ifdef HERMESVM_PROFILER_BB
+            runtime->recordPrototypeCacheHit(curCodeBlock, ip);
+#endif
             CAPTURE_IP_ASSIGN(
                 O1REG(GetById),
-                JSObject::getNamedSlotValue(parent, runtime, cacheEntry->slot));
+                JSObject::getNamedSlotValue(holder, runtime, cacheEntry->slot));
             ip = nextIP;
             DISPATCH;
           }
@@ -2526,7 +2587,7 @@ tailCall:
           // cacheIdx == 0 indicates no caching so don't update the cache in
           // those cases.
           auto *clazz = clazzGCPtr.getNonNull(runtime);
-          if (LLVM_LIKELY(!clazz->isDictionary()) &&
+          if (LLVM_LIKELY(clazz->isWriteCacheable()) &&
               LLVM_LIKELY(cacheIdx != hbc::PROPERTY_CACHING_DISABLED)) {
 #ifdef HERMES_SLOW_DEBUG
             if (cacheEntry->clazz &&
@@ -2578,9 +2639,42 @@ tailCall:
       DISPATCH;
     }
 
+      CASE(GetByValN) {
+        // The name is a number, so it only needs to be checked for being an
+        // array index, without looking at its tag.
+        assert(
+            O3REG(GetByValN).isNumber() &&
+            "GetByValN must only be selected for a number name");
+        if (LLVM_LIKELY(O2REG(GetByValN).isObject())) {
+          if (auto index =
+                  doubleToArrayIndex(O3REG(GetByValN).getNumber())) {
+            HermesValue fastRes = Interpreter::getByIndexObjectFast(
+                runtime, vmcast<JSObject>(O2REG(GetByValN)), *index);
+            if (LLVM_LIKELY(!fastRes.isEmpty())) {
+              O1REG(GetByValN) = fastRes;
+              ip = NEXTINST(GetByValN);
+              DISPATCH;
+            }
+          }
+        }
+        // Otherwise execute it as the GetByVal it is equivalent to. They have
+        // the same operands.
+        goto doGetByVal;
+      }
+    doGetByVal:
       CASE(GetByVal) {
         CallResult<HermesValue> propRes{ExecutionStatus::EXCEPTION};
         if (LLVM_LIKELY(O2REG(GetByVal).isObject())) {
+          // Elements of arrays and typed arrays are loaded without a call.
+          HermesValue fastRes = Interpreter::getByValObjectFast(
+              runtime,
+              vmcast<JSObject>(O2REG(GetByVal)),
+              O3REG(GetByVal));
+          if (LLVM_LIKELY(!fastRes.isEmpty())) {
+            O1REG(GetByVal) = fastRes;
+            ip = NEXTINST(GetByVal);
+            DISPATCH;
+          }
           CAPTURE_IP_ASSIGN(
               resPH,
               JSObject::getComputed_RJS(
@@ -2608,8 +2702,40 @@ tailCall:
         DISPATCH;
       }
 
+      CASE(PutByValN) {
+        // The name is a number, so it only needs to be checked for being an
+        // array index, without looking at its tag.
+        assert(
+            O2REG(PutByValN).isNumber() &&
+            "PutByValN must only be selected for a number name");
+        if (LLVM_LIKELY(O1REG(PutByValN).isObject())) {
+          if (auto index =
+                  doubleToArrayIndex(O2REG(PutByValN).getNumber())) {
+            if (LLVM_LIKELY(Interpreter::putByIndexObjectFast(
+                    runtime,
+                    vmcast<JSObject>(O1REG(PutByValN)),
+                    *index,
+                    O3REG(PutByValN)))) {
+              ip = NEXTINST(PutByValN);
+              DISPATCH;
+            }
+          }
+        }
+        // Otherwise execute it as the PutByVal it is equivalent to. They have
+        // the same operands.
+        goto doPutByVal;
+      }
+    doPutByVal:
       CASE(PutByVal) {
         if (LLVM_LIKELY(O1REG(PutByVal).isObject())) {
+          if (LLVM_LIKELY(Interpreter::putByValObjectFast(
+                  runtime,
+                  vmcast<JSObject>(O1REG(PutByVal)),
+                  O2REG(PutByVal),
+                  O3REG(PutByVal)))) {
+            ip = NEXTINST(PutByVal);
+            DISPATCH;
+          }
           CAPTURE_IP_ASSIGN(
               auto putRes,
               JSObject::putComputed_RJS(
@@ -3446,6 +3572,10 @@ tailCall:
       JCOND(LessEqual, <=, lessEqualOp_RJS);
       JCOND(Greater, >, greaterOp_RJS);
       JCOND(GreaterEqual, >=, greaterEqualOp_RJS);
+      ARITH_JCOND(AddNJLess, +, <, lessOp_RJS);
+      ARITH_JCOND(AddNJLessEqual, +, <=, lessEqualOp_RJS);
+      ARITH_JCOND(SubNJGreater, -, >, greaterOp_RJS);
+      ARITH_JCOND(SubNJGreaterEqual, -, >=, greaterEqualOp_RJS);
 
       JCOND_STRICT_EQ_IMPL(
           JStrictEqual, , IPADD(ip->iJStrictEqual.op1), NEXTINST(JStrictEqual));
@@ -7,6 +7,7 @@
 
 #include "ExternalCalls.h"
 
+#include "hermes/VM/Interpreter-inline.h"
 #include "hermes/VM/JSArray.h"
 #include "hermes/VM/JSObject.h"
 #include "hermes/VM/JSRegExp.h"
@@ -133,7 +134,7 @@ ExecutionStatus externPutById(
         !desc.flags.internalSetter) {
       // cacheIdx == 0 indicates no caching so don't update the cache in
       // those cases.
-      if (LLVM_LIKELY(!clazz->isDictionary()) &&
+      if (LLVM_LIKELY(clazz->isWriteCacheable()) &&
           LLVM_LIKELY(cacheIdx != hbc::PROPERTY_CACHING_DISABLED)) {
         // Cache the class and property slot.
         cacheEntry->clazz = clazzGCPtr.getStorageType();
@@ -190,35 +191,35 @@ CallResult<HermesValue> externGetById(
         !desc.flags.accessor) {
       // cacheIdx == 0 indicates no caching so don't update the cache in
       // those cases.
-      if (LLVM_LIKELY(!clazz->isDictionary()) &&
+      if (LLVM_LIKELY(!clazz->isDictionaryNoCache()) &&
           LLVM_LIKELY(cacheIdx != hbc::PROPERTY_CACHING_DISABLED)) {
         // Cache the class, id and property slot.
         cacheEntry->clazz = clazzGCPtr.getStorageType();
         cacheEntry->slot = desc.slot;
+        cacheEntry->protoDepth = 0;
       }
 
       return JSObject::getNamedSlotValue(obj, runtime, desc);
     }
 
-    // The cache may also be populated via the prototype of the object.
+    // The cache may also be populated via the prototype chain of the object.
     // This value is only reliable if the fast path was a definite
     // not-found.
     if (fastPathResult.hasValue() && !fastPathResult.getValue() &&
         !obj->isProxyObject()) {
-      JSObject *parent = obj->getParent(runtime);
-      // TODO: This isLazy check is because a lazy object is reported as
-      // having no properties and therefore cannot contain the property.
-      // This check does not belong here, it should be merged into
-      // tryGetOwnNamedDescriptorFast().
-      if (parent &&
-          cacheEntry->clazz == parent->getClassGCPtr().getStorageType() &&
-          LLVM_LIKELY(!obj->isLazy())) {
-        return JSObject::getNamedSlotValue(parent, runtime, cacheEntry->slot);
+      if (JSObject *holder = Interpreter::getCachedPrototypeHolder(
+              runtime, obj, id, cacheEntry)) {
+        return JSObject::getNamedSlotValue(holder, runtime, cacheEntry->slot);
       }
     }
 
     return JSObject::getNamed_RJS(
-               Handle<JSObject>::vmcast(target), runtime, id, opFlags)
+               Handle<JSObject>::vmcast(target),
+               runtime,
+               id,
+               opFlags,
+               cacheIdx != hbc::PROPERTY_CACHING_DISABLED ? cacheEntry
+                                                          : nullptr)
         .toCallResultHermesValue();
   } else {
     /* Slow path. */
@@ -485,6 +486,11 @@ CallResult<HermesValue> externGetByVal(
   GCScopeMarkerRAII marker{runtime};
 
   if (LLVM_LIKELY(target->isObject())) {
+    HermesValue fastRes = Interpreter::getByValObjectFast(
+        runtime, vmcast<JSObject>(*target), *nameVal);
+    if (LLVM_LIKELY(!fastRes.isEmpty())) {
+      return fastRes;
+    }
     return JSObject::getComputed_RJS(
                Handle<JSObject>::vmcast(target), runtime, Handle<>(nameVal))
         .toCallResultHermesValue();
@@ -496,6 +502,22 @@ CallResult<HermesValue> externGetByVal(
   }
 }
 
+CallResult<HermesValue> externGetByValN(
+    Runtime *runtime,
+    PinnedHermesValue *target,
+    PinnedHermesValue *nameVal) {
+  if (LLVM_LIKELY(target->isObject())) {
+    if (auto index = doubleToArrayIndex(nameVal->getNumber())) {
+      HermesValue fastRes = Interpreter::getByIndexObjectFast(
+          runtime, vmcast<JSObject>(*target), *index);
+      if (LLVM_LIKELY(!fastRes.isEmpty())) {
+        return fastRes;
+      }
+    }
+  }
+  return externGetByVal(runtime, target, nameVal);
+}
+
 ExecutionStatus externPutByVal(
     Runtime *runtime,
     PinnedHermesValue *target,
@@ -505,6 +527,10 @@ ExecutionStatus externPutByVal(
   GCScopeMarkerRAII marker{runtime};
 
   if (LLVM_LIKELY(target->isObject())) {
+    if (LLVM_LIKELY(Interpreter::putByValObjectFast(
+            runtime, vmcast<JSObject>(*target), *nameVal, *value))) {
+      return ExecutionStatus::RETURNED;
+    }
     return JSObject::putComputed_RJS(
                Handle<JSObject>::vmcast(target),
                runtime,
@@ -523,6 +549,23 @@ ExecutionStatus externPutByVal(
   }
 }
 
+ExecutionStatus externPutByValN(
+    Runtime *runtime,
+    PinnedHermesValue *target,
+    PinnedHermesValue *nameVal,
+    PinnedHermesValue *value,
+    PropOpFlags flags) {
+  if (LLVM_LIKELY(target->isObject())) {
+    if (auto index = doubleToArrayIndex(nameVal->getNumber())) {
+      if (LLVM_LIKELY(Interpreter::putByIndexObjectFast(
+              runtime, vmcast<JSObject>(*target), *index, *value))) {
+        return ExecutionStatus::RETURNED;
+      }
+    }
+  }
+  return externPutByVal(runtime, target, nameVal, value, flags);
+}
+
 CallResult<HermesValue> externDelByVal(
     Runtime *runtime,
     PinnedHermesValue *target,
@@ -229,6 +229,12 @@ CallResult<HermesValue> externGetByVal(
     PinnedHermesValue *target,
     PinnedHermesValue *nameVal);
 
+/// Same as externGetByVal(), for a \p nameVal which is a number.
+CallResult<HermesValue> externGetByValN(
+    Runtime *runtime,
+    PinnedHermesValue *target,
+    PinnedHermesValue *nameVal);
+
 /// An external call invoked by JIT compiled code to set a property to the \p
 /// value by the index \p nameVal in the object \p target
 /// \param flags property access flags
@@ -239,6 +245,14 @@ ExecutionStatus externPutByVal(
     PinnedHermesValue *value,
     PropOpFlags flags);
 
+/// Same as externPutByVal(), for a \p nameVal which is a number.
+ExecutionStatus externPutByValN(
+    Runtime *runtime,
+    PinnedHermesValue *target,
+    PinnedHermesValue *nameVal,
+    PinnedHermesValue *value,
+    PropOpFlags flags);
+
 /// An external call invoked by JIT compiled code to delete a property by \p
 /// nameVal from the object \p target
 /// \param flags property access flags
@@ -338,6 +338,32 @@ Emitters FastJIT::compileBB(Emitters emit) {
   JCOND_IMPL(name, , cc, slowPathCall); \
   JCOND_IMPL(name, Long, cc, slowPathCall);
 
+/// Implement an arithmetic conditional jump superinstruction and its long
+/// version.
+/// \param name the name of the instruction.
+/// \param isSub whether the arithmetic is a subtraction, otherwise addition.
+/// \param cc the conditional code indicating when to jump.
+/// \param slowPathCall function to call for the slow-path comparison.
+#define ARITH_JCOND_IMPL(name, suffix, isSub, cc, slowPathCall) \
+  case OpCode::name##suffix:                                    \
+    emit = compileArithNCondJump(                               \
+        emit,                                                   \
+        ip,                                                     \
+        ip->i##name##suffix.op1,                                \
+        ip->i##name##suffix.op2,                                \
+        ip->i##name##suffix.op3,                                \
+        ip->i##name##suffix.op4,                                \
+        ip->i##name##suffix.op5,                                \
+        isSub,                                                  \
+        CJumpOp<cc>::OP,                                        \
+        (void *)slowPathCall);                                  \
+    ip = NEXTINST(name##suffix);                                \
+    break
+
+#define ARITH_JCOND(name, isSub, cc, slowPathCall)   \
+  ARITH_JCOND_IMPL(name, , isSub, cc, slowPathCall); \
+  ARITH_JCOND_IMPL(name, Long, isSub, cc, slowPathCall);
+
 /// Implement a jump based on equality test and its long version
 /// \param name the name of the instruction.
 /// \param cc the conditional code indicating when to jump.
@@ -491,6 +517,11 @@ Emitters FastJIT::compileBB(Emitters emit) {
       JCOND(JNotGreater, CCode::NA, slowPathLessEq);
       JCOND(JNotGreaterEqual, CCode::NAE, slowPathLess);
 
+      ARITH_JCOND(AddNJLess, false, CCode::B, slowPathLess);
+      ARITH_JCOND(AddNJLessEqual, false, CCode::BE, slowPathLessEq);
+      ARITH_JCOND(SubNJGreater, true, CCode::A, slowPathGreater);
+      ARITH_JCOND(SubNJGreaterEqual, true, CCode::AE, slowPathGreaterEq);
+
       // JEqual jumps when the equality test returns non-zero (true)
       JEQ(JEqual, CCode::NZ, compileEqJump);
       // JNotEqual jumps when the equality test returns zero (false)
@@ -545,7 +576,9 @@ Emitters FastJIT::compileBB(Emitters emit) {
       CASE(NewObjectWithBuffer);
       CASE(NewObjectWithBufferLong);
       CASE_3REG(GetByVal);
+      CASE_3REG(GetByValN);
       CASE(PutByVal);
+      CASE(PutByValN);
       CASE(DelByVal);
       CASE(StoreToEnvironment);
       CASE(StoreToEnvironmentL);
@@ -1625,6 +1658,31 @@ Emitters FastJIT::compileCondJump(
   return emit;
 }
 
+Emitters FastJIT::compileArithNCondJump(
+    Emitters emit,
+    const Inst *ip,
+    uint32_t ipOffset,
+    uint32_t resReg,
+    uint32_t reg1,
+    uint32_t reg2,
+    uint32_t cmpReg,
+    bool isSub,
+    uint8_t opCode,
+    void *slowPathCall) {
+  emit.fast = movHermesRegToNativeReg<true>(emit.fast, reg1, Reg::XMM0);
+  if (isSub) {
+    emit.fast.subfpRMFromReg(
+        RegFrame, Reg::NoIndex, localHermesRegByteOffset(reg2), Reg::XMM0);
+  } else {
+    emit.fast.addfpRMToReg(
+        RegFrame, Reg::NoIndex, localHermesRegByteOffset(reg2), Reg::XMM0);
+  }
+  emit.fast = movNativeRegToHermesReg<true>(emit.fast, Reg::XMM0, resReg);
+
+  return compileCondJump(
+      emit, ip, ipOffset, resReg, cmpReg, opCode, slowPathCall);
+}
+
 Emitters FastJIT::compileNewObject(Emitters emit, const Inst *ip) {
   uint8_t *constAddr;
   emit.slow = getConstant(emit.slow, (void *)externNewObject, constAddr);
@@ -1946,6 +2004,17 @@ Emitters FastJIT::newObjectWithBufferHelper(
 }
 
 Emitters FastJIT::compilePutByVal(Emitters emit, const Inst *ip) {
+  return compilePutByValInst(emit, ip, (void *)externPutByVal);
+}
+
+Emitters FastJIT::compilePutByValN(Emitters emit, const Inst *ip) {
+  return compilePutByValInst(emit, ip, (void *)externPutByValN);
+}
+
+Emitters FastJIT::compilePutByValInst(
+    Emitters emit,
+    const Inst *ip,
+    void *externCallAddr) {
   // object -> arg2
   emit.fast = leaHermesReg(emit.fast, ip->iPutByVal.op1, Reg::rsi);
   // nameVal -> arg3
@@ -1959,7 +2028,7 @@ Emitters FastJIT::compilePutByVal(Emitters emit, const Inst *ip) {
   emit.fast.movImmToReg<S::L>(defaultPropOpFlags.getRaw(), Reg::r8d);
 
   uint8_t *constAddr;
-  emit.slow = getConstant(emit.slow, (void *)externPutByVal, constAddr);
+  emit.slow = getConstant(emit.slow, externCallAddr, constAddr);
   emit.fast = callExternalNoReturnedVal(emit.fast, constAddr, ip);
   return emit;
 }
@@ -471,6 +471,20 @@ class FastJIT {
       uint32_t reg2,
       uint8_t opCode,
       void *slowPathCall);
+  /// Compile a superinstruction which stores \p reg1 + \p reg2 (or
+  /// \p reg1 - \p reg2 if \p isSub) into \p resReg, and then jumps based on
+  /// comparing \p resReg with \p cmpReg.
+  Emitters compileArithNCondJump(
+      Emitters emit,
+      const Inst *ip,
+      uint32_t ipOffset,
+      uint32_t resReg,
+      uint32_t reg1,
+      uint32_t reg2,
+      uint32_t cmpReg,
+      bool isSub,
+      uint8_t opCode,
+      void *slowPathCall);
   Emitters
   compileLoadConstString(Emitters emit, const Inst *ip, uint32_t stringID);
   Emitters compileStrictEqJump(
@@ -535,6 +549,11 @@ class FastJIT {
   Emitters compileNewObjectWithBuffer(Emitters emit, const Inst *ip);
   Emitters compileNewObjectWithBufferLong(Emitters emit, const Inst *ip);
   Emitters compilePutByVal(Emitters emit, const Inst *ip);
+  Emitters compilePutByValN(Emitters emit, const Inst *ip);
+  /// Emit a PutByVal or PutByValN, which have the same operands, with a call
+  /// to \p externCallAddr.
+  Emitters
+  compilePutByValInst(Emitters emit, const Inst *ip, void *externCallAddr);
   Emitters compileDelByVal(Emitters emit, const Inst *ip);
   Emitters compileStoreToEnvironment(Emitters emit, const Inst *ip);
   Emitters compileStoreToEnvironmentL(Emitters emit, const Inst *ip);
@@ -174,6 +174,14 @@ void JSArrayBuffer::_finalizeImpl(GCCell *cell, GC *gc) {
   auto *self = vmcast<JSArrayBuffer>(cell);
   // Need to untrack the native memory that may have been tracked by snapshots.
   gc->getIDTracker().untrackNative(self->data_);
+  if (self->data_) {
+    // Nothing else refers to the data, so it may be freed after the
+    // collection.
+    gc->debitExternalMemory(self, self->size_);
+    gc->releaseNative([](void *data) { free(data); }, self->data_);
+    self->data_ = nullptr;
+    self->size_ = 0;
+  }
   self->detach(gc);
   self->~JSArrayBuffer();
 }
@@ -392,6 +392,47 @@ class StringCycleChecker {
 };
 } // namespace
 
+/// Read the element \p k of \p O straight from the indexed storage, if \p O
+/// is an array and the element is in its storage: such an element is an own
+/// data property, so its value is the result of Get(O, k) and HasProperty(O, k)
+/// is true. This is checked again for every element, since the callbacks of
+/// the iterating builtins can change the array.
+/// \return the element, or empty if the general path must be taken (the
+///   element is a hole or outside the storage, or \p O is not a plain array).
+static inline HermesValue
+getArrayElementFast(Runtime *runtime, Handle<JSObject> O, Handle<> k) {
+  auto *arr = dyn_vmcast<JSArray>(O.get());
+  if (LLVM_UNLIKELY(!arr || !arr->hasFastIndexProperties()))
+    return HermesValue::encodeEmptyValue();
+  auto index = toArrayIndexFastPath(*k);
+  if (LLVM_UNLIKELY(!index))
+    return HermesValue::encodeEmptyValue();
+  return arr->at(runtime, *index);
+}
+
+/// Get the element \p k of \p O if O has the property \p k, either itself or
+/// in its prototype chain, using getArrayElementFast() when it applies.
+/// \param descObjHandle scratch handle for the descriptor lookup.
+/// \return the element, or empty if \p O has no property \p k.
+static inline CallResult<PseudoHandle<>> getElementIfPresent(
+    Runtime *runtime,
+    Handle<JSObject> O,
+    Handle<> k,
+    MutableHandle<JSObject> &descObjHandle) {
+  HermesValue fastValue = getArrayElementFast(runtime, O, k);
+  if (LLVM_LIKELY(!fastValue.isEmpty()))
+    return createPseudoHandle(fastValue);
+
+  ComputedPropertyDescriptor desc;
+  if (LLVM_UNLIKELY(
+          JSObject::getComputedPrimitiveDescriptor(
+              O, runtime, k, descObjHandle, desc) ==
+          ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  return JSObject::getComputedPropertyValue_RJS(
+      O, runtime, descObjHandle, desc, k);
+}
+
 /// ES5.1 15.4.4.5.
 CallResult<HermesValue>
 arrayPrototypeToString(void *, Runtime *runtime, NativeArgs args) {
@@ -980,6 +1021,9 @@ class StandardSortModel : public SortModel {
   /// can be flushed.
   GCScope::Marker gcMarker_;
 
+  /// Calls compareFn_, if there is one.
+  llvm::Optional<PreparedCall> compareCall_;
+
  public:
   StandardSortModel(
       Runtime *runtime,
@@ -995,7 +1039,10 @@ class StandardSortModel : public SortModel {
         bValue_(runtime),
         aDescObjHandle_(runtime),
         bDescObjHandle_(runtime),
-        gcMarker_(gcScope_.createMarker()) {}
+        gcMarker_(gcScope_.createMarker()) {
+    if (compareFn)
+      compareCall_.emplace(runtime, compareFn, 2);
+  }
 
   /// Use getComputed and putComputed to swap the values at obj[a] and obj[b].
   ExecutionStatus swap(uint32_t a, uint32_t b) override {
@@ -1175,12 +1222,8 @@ class StandardSortModel : public SortModel {
 
     if (compareFn_) {
       // If we have a compareFn, just use that.
-      auto callRes = Callable::executeCall2(
-          compareFn_,
-          runtime_,
-          Runtime::getUndefinedValue(),
-          aValue_.get(),
-          bValue_.get());
+      auto callRes = compareCall_->call(
+          Runtime::getUndefinedValue(), {aValue_.get(), bValue_.get()});
       if (LLVM_UNLIKELY(callRes == ExecutionStatus::EXCEPTION)) {
         return ExecutionStatus::EXCEPTION;
       }
@@ -1278,30 +1321,25 @@ arrayPrototypeForEach(void *, Runtime *runtime, NativeArgs args) {
 
   MutableHandle<JSObject> descObjHandle{runtime};
 
+  PreparedCall callback{runtime, callbackFn, 3};
+
   // Loop through and execute the callback on all existing values.
-  // TODO: Implement a fast path for actual arrays.
   auto marker = gcScope.createMarker();
   while (k->getDouble() < len) {
     gcScope.flushToMarker(marker);
 
-    ComputedPropertyDescriptor desc;
-    JSObject::getComputedPrimitiveDescriptor(
-        O, runtime, k, descObjHandle, desc);
-    CallResult<PseudoHandle<>> propRes = JSObject::getComputedPropertyValue_RJS(
-        O, runtime, descObjHandle, desc, k);
+    CallResult<PseudoHandle<>> propRes =
+        getElementIfPresent(runtime, O, k, descObjHandle);
     if (LLVM_UNLIKELY(propRes == ExecutionStatus::EXCEPTION)) {
       return ExecutionStatus::EXCEPTION;
     }
     if (LLVM_LIKELY(!(*propRes)->isEmpty())) {
       auto kValue = std::move(*propRes);
       if (LLVM_UNLIKELY(
-              Callable::executeCall3(
-                  callbackFn,
-                  runtime,
+              callback.call(
                   args.getArgHandle(1),
-                  kValue.get(),
-                  k.get(),
-                  O.getHermesValue()) == ExecutionStatus::EXCEPTION)) {
+                  {kValue.get(), k.get(), O.getHermesValue()}) ==
+              ExecutionStatus::EXCEPTION)) {
         return ExecutionStatus::EXCEPTION;
       }
     }
@@ -1658,13 +1696,9 @@ arrayPrototypeSlice(void *, Runtime *runtime, NativeArgs args) {
   auto marker = gcScope.createMarker();
 
   // Copy the elements between the actual start and end indices into A.
-  // TODO: Implement a fast path for actual arrays.
   while (k->getNumber() < fin) {
-    ComputedPropertyDescriptor desc;
-    JSObject::getComputedPrimitiveDescriptor(
-        O, runtime, k, descObjHandle, desc);
-    CallResult<PseudoHandle<>> propRes = JSObject::getComputedPropertyValue_RJS(
-        O, runtime, descObjHandle, desc, k);
+    CallResult<PseudoHandle<>> propRes =
+        getElementIfPresent(runtime, O, k, descObjHandle);
     if (LLVM_UNLIKELY(propRes == ExecutionStatus::EXCEPTION)) {
       return ExecutionStatus::EXCEPTION;
     }
@@ -2356,11 +2390,8 @@ indexOfHelper(Runtime *runtime, NativeArgs args, const bool reverse) {
         break;
       }
     }
-    ComputedPropertyDescriptor desc;
-    JSObject::getComputedPrimitiveDescriptor(
-        O, runtime, k, descObjHandle, desc);
-    CallResult<PseudoHandle<>> propRes = JSObject::getComputedPropertyValue_RJS(
-        O, runtime, descObjHandle, desc, k);
+    CallResult<PseudoHandle<>> propRes =
+        getElementIfPresent(runtime, O, k, descObjHandle);
     if (LLVM_UNLIKELY(propRes == ExecutionStatus::EXCEPTION)) {
       return ExecutionStatus::EXCEPTION;
     }
@@ -2530,29 +2561,23 @@ everySomeHelper(Runtime *runtime, NativeArgs args, const bool every) {
   MutableHandle<JSObject> descObjHandle{runtime};
   MutableHandle<> kValue{runtime};
 
+  PreparedCall callback{runtime, callbackFn, 3};
+
   // Loop through and run the callback.
   auto marker = gcScope.createMarker();
   while (k->getDouble() < len) {
     gcScope.flushToMarker(marker);
 
-    ComputedPropertyDescriptor desc;
-    JSObject::getComputedPrimitiveDescriptor(
-        O, runtime, k, descObjHandle, desc);
-    CallResult<PseudoHandle<>> propRes = JSObject::getComputedPropertyValue_RJS(
-        O, runtime, descObjHandle, desc, k);
+    CallResult<PseudoHandle<>> propRes =
+        getElementIfPresent(runtime, O, k, descObjHandle);
     if (LLVM_UNLIKELY(propRes == ExecutionStatus::EXCEPTION)) {
       return ExecutionStatus::EXCEPTION;
     }
     if (LLVM_LIKELY(!(*propRes)->isEmpty())) {
       // kPresent is true, call the callback on the kth element.
       kValue = std::move(*propRes);
-      auto callRes = Callable::executeCall3(
-          callbackFn,
-          runtime,
-          args.getArgHandle(1),
-          kValue.get(),
-          k.get(),
-          O.getHermesValue());
+      auto callRes = callback.call(
+          args.getArgHandle(1), {kValue.get(), k.get(), O.getHermesValue()});
       if (LLVM_UNLIKELY(callRes == ExecutionStatus::EXCEPTION)) {
         return ExecutionStatus::EXCEPTION;
       }
@@ -2629,30 +2654,23 @@ arrayPrototypeMap(void *, Runtime *runtime, NativeArgs args) {
 
   MutableHandle<JSObject> descObjHandle{runtime};
 
+  PreparedCall callback{runtime, callbackFn, 3};
+
   // Main loop to execute callback and store the results in A.
-  // TODO: Implement a fast path for actual arrays.
   auto marker = gcScope.createMarker();
   while (k->getDouble() < len) {
     gcScope.flushToMarker(marker);
 
-    ComputedPropertyDescriptor desc;
-    JSObject::getComputedPrimitiveDescriptor(
-        O, runtime, k, descObjHandle, desc);
-    CallResult<PseudoHandle<>> propRes = JSObject::getComputedPropertyValue_RJS(
-        O, runtime, descObjHandle, desc, k);
+    CallResult<PseudoHandle<>> propRes =
+        getElementIfPresent(runtime, O, k, descObjHandle);
     if (LLVM_UNLIKELY(propRes == ExecutionStatus::EXCEPTION)) {
       return ExecutionStatus::EXCEPTION;
     }
     if (LLVM_LIKELY(!(*propRes)->isEmpty())) {
       // kPresent is true, execute callback and store result in A[k].
       auto kValue = std::move(*propRes);
-      auto callRes = Callable::executeCall3(
-          callbackFn,
-          runtime,
-          args.getArgHandle(1),
-          kValue.get(),
-          k.get(),
-          O.getHermesValue());
+      auto callRes = callback.call(
+          args.getArgHandle(1), {kValue.get(), k.get(), O.getHermesValue()});
       if (LLVM_UNLIKELY(callRes == ExecutionStatus::EXCEPTION)) {
         return ExecutionStatus::EXCEPTION;
       }
@@ -2710,28 +2728,22 @@ arrayPrototypeFilter(void *, Runtime *runtime, NativeArgs args) {
   MutableHandle<JSObject> descObjHandle{runtime};
   MutableHandle<> kValue{runtime};
 
+  PreparedCall callback{runtime, callbackFn, 3};
+
   auto marker = gcScope.createMarker();
   while (k->getDouble() < len) {
     gcScope.flushToMarker(marker);
 
-    ComputedPropertyDescriptor desc;
-    JSObject::getComputedPrimitiveDescriptor(
-        O, runtime, k, descObjHandle, desc);
-    CallResult<PseudoHandle<>> propRes = JSObject::getComputedPropertyValue_RJS(
-        O, runtime, descObjHandle, desc, k);
+    CallResult<PseudoHandle<>> propRes =
+        getElementIfPresent(runtime, O, k, descObjHandle);
     if (LLVM_UNLIKELY(propRes == ExecutionStatus::EXCEPTION)) {
       return ExecutionStatus::EXCEPTION;
     }
     if (LLVM_LIKELY(!(*propRes)->isEmpty())) {
       kValue = std::move(*propRes);
       // Call the callback.
-      auto callRes = Callable::executeCall3(
-          callbackFn,
-          runtime,
-          args.getArgHandle(1),
-          kValue.get(),
-          k.get(),
-          O.getHermesValue());
+      auto callRes = callback.call(
+          args.getArgHandle(1), {kValue.get(), k.get(), O.getHermesValue()});
       if (LLVM_UNLIKELY(callRes == ExecutionStatus::EXCEPTION)) {
         return ExecutionStatus::EXCEPTION;
       }
@@ -2843,22 +2855,24 @@ arrayPrototypeFind(void *ctx, Runtime *runtime, NativeArgs args) {
 
   MutableHandle<> kHandle{runtime, HermesValue::encodeNumberValue(0)};
   MutableHandle<> kValue{runtime};
+  PreparedCall callback{runtime, predicate, 3};
   auto marker = gcScope.createMarker();
   while (kHandle->getNumber() < len) {
     gcScope.flushToMarker(marker);
-    if (LLVM_UNLIKELY(
-            (propRes = JSObject::getComputed_RJS(O, runtime, kHandle)) ==
-            ExecutionStatus::EXCEPTION)) {
-      return ExecutionStatus::EXCEPTION;
+    kValue = getArrayElementFast(runtime, O, kHandle);
+    if (LLVM_UNLIKELY(kValue->isEmpty())) {
+      if (LLVM_UNLIKELY(
+              (propRes = JSObject::getComputed_RJS(O, runtime, kHandle)) ==
+              ExecutionStatus::EXCEPTION)) {
+        return ExecutionStatus::EXCEPTION;
+      }
+      kValue = std::move(*propRes);
     }
-    kValue = std::move(*propRes);
-    auto callRes = Callable::executeCall3(
-        predicate,
-        runtime,
+    auto callRes = callback.call(
         T,
-        kValue.getHermesValue(),
-        kHandle.getHermesValue(),
-        O.getHermesValue());
+        {kValue.getHermesValue(),
+         kHandle.getHermesValue(),
+         O.getHermesValue()});
     if (LLVM_UNLIKELY(callRes == ExecutionStatus::EXCEPTION)) {
       return ExecutionStatus::EXCEPTION;
     }
@@ -2942,12 +2956,8 @@ reduceHelper(Runtime *runtime, NativeArgs args, const bool reverse) {
           break;
         }
       }
-      ComputedPropertyDescriptor kDesc;
-      JSObject::getComputedPrimitiveDescriptor(
-          O, runtime, k, kDescObjHandle, kDesc);
       CallResult<PseudoHandle<>> propRes =
-          JSObject::getComputedPropertyValue_RJS(
-              O, runtime, kDescObjHandle, kDesc, k);
+          getElementIfPresent(runtime, O, k, kDescObjHandle);
       if (LLVM_UNLIKELY(propRes == ExecutionStatus::EXCEPTION)) {
         return ExecutionStatus::EXCEPTION;
       }
@@ -2964,6 +2974,7 @@ reduceHelper(Runtime *runtime, NativeArgs args, const bool reverse) {
   }
 
   // Perform the reduce.
+  PreparedCall callback{runtime, callbackFn, 4};
   while (true) {
     gcScope.flushToMarker(marker);
     if (!reverse) {
@@ -2976,25 +2987,17 @@ reduceHelper(Runtime *runtime, NativeArgs args, const bool reverse) {
       }
     }
 
-    ComputedPropertyDescriptor kDesc;
-    JSObject::getComputedPrimitiveDescriptor(
-        O, runtime, k, kDescObjHandle, kDesc);
-    CallResult<PseudoHandle<>> propRes = JSObject::getComputedPropertyValue_RJS(
-        O, runtime, kDescObjHandle, kDesc, k);
+    CallResult<PseudoHandle<>> propRes =
+        getElementIfPresent(runtime, O, k, kDescObjHandle);
     if (LLVM_UNLIKELY(propRes == ExecutionStatus::EXCEPTION)) {
       return ExecutionStatus::EXCEPTION;
     }
     if (LLVM_LIKELY(!(*propRes)->isEmpty())) {
       // kPresent is true, run the accumulation step.
       auto kValue = std::move(*propRes);
-      auto callRes = Callable::executeCall4(
-          callbackFn,
-          runtime,
+      auto callRes = callback.call(
           Runtime::getUndefinedValue(),
-          accumulator.get(),
-          kValue.get(),
-          k.get(),
-          O.getHermesValue());
+          {accumulator.get(), kValue.get(), k.get(), O.getHermesValue()});
       if (LLVM_UNLIKELY(callRes == ExecutionStatus::EXCEPTION)) {
         return ExecutionStatus::EXCEPTION;
       }
@@ -3199,6 +3202,7 @@ arrayPrototypeIncludes(void *, Runtime *runtime, NativeArgs args) {
   }
 
   MutableHandle<> kHandle{runtime};
+  MutableHandle<> elementK{runtime};
 
   // 7. Repeat, while k < len
   auto marker = gcScope.createMarker();
@@ -3207,13 +3211,17 @@ arrayPrototypeIncludes(void *, Runtime *runtime, NativeArgs args) {
 
     // 7a. Let elementK be the result of ? Get(O, ! ToString(k)).
     kHandle = HermesValue::encodeNumberValue(k);
-    auto elementKRes = JSObject::getComputed_RJS(O, runtime, kHandle);
-    if (LLVM_UNLIKELY(elementKRes == ExecutionStatus::EXCEPTION)) {
-      return ExecutionStatus::EXCEPTION;
+    elementK = getArrayElementFast(runtime, O, kHandle);
+    if (LLVM_UNLIKELY(elementK->isEmpty())) {
+      auto elementKRes = JSObject::getComputed_RJS(O, runtime, kHandle);
+      if (LLVM_UNLIKELY(elementKRes == ExecutionStatus::EXCEPTION)) {
+        return ExecutionStatus::EXCEPTION;
+      }
+      elementK = std::move(*elementKRes);
     }
 
     // 7b. If SameValueZero(searchElement, elementK) is true, return true.
-    if (isSameValueZero(args.getArg(0), elementKRes->get())) {
+    if (isSameValueZero(args.getArg(0), elementK.get())) {
       return HermesValue::encodeBoolValue(true);
     }
 
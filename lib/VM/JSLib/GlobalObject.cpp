@@ -10,6 +10,7 @@
 /// Initialize the global object ES5.1 15.1
 //===----------------------------------------------------------------------===//
 #include "hermes/Platform/Intl/PlatformIntl.h"
+#include "hermes/Support/Conversions.h"
 #include "hermes/VM/JSArrayBuffer.h"
 #include "hermes/VM/JSDataView.h"
 #include "hermes/VM/JSLib.h"
@@ -18,8 +19,6 @@
 #include "hermes/VM/PrimitiveBox.h"
 #include "hermes/VM/StringView.h"
 
-#include "dtoa/dtoa.h"
-
 #include "JSLibInternal.h"
 
 namespace hermes {
@@ -200,40 +199,22 @@ CallResult<HermesValue> parseFloat(void *, Runtime *runtime, NativeArgs args) {
     return HermesValue::encodeNaNValue();
   }
 
-  // Copy 16 bit chars into 8 bit chars as long as the character is
-  // still a valid decimal number character.
+  // Parse the longest prefix which is a decimal number.
   auto len = str16.length();
-  llvm::SmallVector<char, 32> str8(len + 1);
-  uint32_t i = 0;
-  for (auto c : str16) {
-    if ((c >= u'0' && c <= u'9') || c == '.' || letterToLower(c) == 'e' ||
-        c == '+' || c == '-') {
-      str8[i] = static_cast<char>(c);
-    } else {
-      break;
-    }
-    ++i;
+  double result;
+  bool parsed;
+  if (str16.isASCII()) {
+    const char *begin = str16.castToCharPtr();
+    parsed = parseDecimalPrefix(begin, begin + len, result) != begin;
+  } else {
+    const char16_t *begin = str16.castToChar16Ptr();
+    parsed = parseDecimalPrefix(begin, begin + len, result) != begin;
   }
-  if (i == 0) {
-    // Empty string.
+  if (!parsed) {
+    // No number.
     return HermesValue::encodeNaNValue();
   }
-  // Use hermes_g_strtod to figure out the longest prefix that's still valid.
-  // hermes_g_strtod will try to convert the string to int for as long as it
-  // can, and set endPtr to the last location where the prefix so far is still
-  // a valid integer.
-  len = i;
-  str8[len] = '\0';
-  char *endPtr;
-  ::hermes_g_strtod(str8.data(), &endPtr);
-  if (endPtr == str8.data()) {
-    // Empty string.
-    return HermesValue::encodeNaNValue();
-  }
-  // Now we know the prefix untill endPtr is a valid int.
-  *endPtr = '\0';
-  return HermesValue::encodeDoubleValue(
-      ::hermes_g_strtod(str8.data(), &endPtr));
+  return HermesValue::encodeDoubleValue(result);
 }
 
 /// Customized global function. gc() forces a GC collect.
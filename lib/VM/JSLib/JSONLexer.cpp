@@ -7,10 +7,9 @@
 
 #include "JSONLexer.h"
 
+#include "hermes/Support/Conversions.h"
 #include "hermes/VM/StringPrimitive.h"
 
-#include "dtoa/dtoa.h"
-
 namespace hermes {
 namespace vm {
 
@@ -113,12 +112,11 @@ ExecutionStatus JSONLexer::scanNumber() {
     return errorWithChar(u"Unexpected token in number: ", str8[1]);
   }
 
-  str8.push_back('\0');
-
-  char *endPtr;
-  double value = ::hermes_g_strtod(str8.data(), &endPtr);
-  if (endPtr != str8.data() + len) {
-    return errorWithChar(u"Unexpected token in number: ", *endPtr);
+  double value;
+  const char *end = str8.data() + len;
+  const char *numEnd = parseDecimalPrefix(str8.data(), end, value);
+  if (numEnd != end) {
+    return errorWithChar(u"Unexpected token in number: ", *numEnd);
   }
   token_.setNumber(value);
   return ExecutionStatus::RETURNED;
@@ -53,6 +53,9 @@ class RuntimeJSONParser {
   /// https://es5.github.io/#x15.12.2
   Handle<Callable> reviver_;
 
+  /// Calls reviver_ while reviving, see revive().
+  llvm::Optional<PreparedCall> reviverCall_;
+
   /// A temporary handle, to avoid creating new handles when a temporary one
   /// is needed to protect some HermesValue.
   MutableHandle<> tmpHandle_;
@@ -468,8 +471,12 @@ CallResult<HermesValue> RuntimeJSONParser::revive(Handle<> value) {
   assert(
       status != ExecutionStatus::EXCEPTION && *status &&
       "defineOwnProperty on new object cannot fail");
-  return operationWalk(
+  // The reviver is called once for every value in the result.
+  reviverCall_.emplace(runtime_, reviver_, 2);
+  auto result = operationWalk(
       root, runtime_->getPredefinedStringHandle(Predefined::emptyString));
+  reviverCall_.reset();
+  return result;
 }
 
 CallResult<HermesValue> RuntimeJSONParser::operationWalk(
@@ -532,8 +539,7 @@ CallResult<HermesValue> RuntimeJSONParser::operationWalk(
   }
   tmpHandle = strRes->getHermesValue();
 
-  return Callable::executeCall2(
-             reviver_, runtime_, holder, *tmpHandle, *valHandle)
+  return reviverCall_->call(holder, {*tmpHandle, *valHandle})
       .toCallResultHermesValue();
 }
 
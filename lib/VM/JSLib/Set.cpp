@@ -215,7 +215,11 @@ setPrototypeAdd(void *, Runtime *runtime, NativeArgs args) {
         "Method Set.prototype.add called on incompatible receiver");
   }
   auto valueHandle = args.getArgHandle(0);
-  JSSet::addValue(selfHandle, runtime, valueHandle, valueHandle);
+  if (LLVM_UNLIKELY(
+          JSSet::addValue(selfHandle, runtime, valueHandle, valueHandle) ==
+          ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
   return selfHandle.getHermesValue();
 }
 
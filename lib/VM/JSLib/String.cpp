@@ -12,6 +12,7 @@
 #include "JSLibInternal.h"
 
 #include "hermes/Platform/Unicode/PlatformUnicode.h"
+#include "hermes/Support/StringSearch.h"
 #include "hermes/VM/JSLib/RuntimeCommonStorage.h"
 #include "hermes/VM/Operations.h"
 #include "hermes/VM/PrimitiveBox.h"
@@ -717,6 +718,48 @@ stringPrototypeConcat(void *, Runtime *runtime, NativeArgs args) {
   return builder->getStringPrimitive().getHermesValue();
 }
 
+/// \return the code units of \p str, which must be of type \p T.
+template <typename T>
+static llvm::ArrayRef<T> codeUnits(const StringView &str);
+template <>
+llvm::ArrayRef<char> codeUnits<char>(const StringView &str) {
+  return {str.castToCharPtr(), str.length()};
+}
+template <>
+llvm::ArrayRef<char16_t> codeUnits<char16_t>(const StringView &str) {
+  return {str.castToChar16Ptr(), str.length()};
+}
+
+template <typename HayT, typename NeedleT>
+static size_t searchCodeUnits(
+    const StringView &hay,
+    const StringView &needle,
+    uint32_t pos,
+    bool reverse) {
+  return reverse
+      ? stringSearchBackward(
+            codeUnits<HayT>(hay), codeUnits<NeedleT>(needle), pos)
+      : stringSearch(codeUnits<HayT>(hay), codeUnits<NeedleT>(needle), pos);
+}
+
+/// Find \p needle in \p hay, starting at or after \p pos, or when \p reverse
+/// is set, starting at or before \p pos.
+/// \return the index of the match, or kStringSearchNoMatch if there is none.
+static size_t searchStringView(
+    StringView hay,
+    StringView needle,
+    uint32_t pos,
+    bool reverse = false) {
+  if (hay.isASCII()) {
+    return needle.isASCII()
+        ? searchCodeUnits<char, char>(hay, needle, pos, reverse)
+        : searchCodeUnits<char, char16_t>(hay, needle, pos, reverse);
+  }
+  return needle.isASCII()
+      ? searchCodeUnits<char16_t, char>(hay, needle, pos, reverse)
+      : searchCodeUnits<char16_t, char16_t>(hay, needle, pos, reverse);
+}
+
 /// Works slightly differently from the given implementation in the spec.
 /// Given a string \p S and a starting point \p q, finds the first match of
 /// \p R such that it starts on or after index \p q in \p S.
@@ -747,13 +790,9 @@ static CallResult<RegExpMatch> splitMatch(
     return match;
   }
 
-  auto sliced = SStr.slice(q);
-  auto searchResult =
-      std::search(sliced.begin(), sliced.end(), RStr.begin(), RStr.end());
-
-  if (searchResult != sliced.end()) {
-    uint32_t i = q + (searchResult - sliced.begin());
-    match.push_back({{i, RHandle->getStringLength()}});
+  size_t i = searchStringView(SStr, RStr, q);
+  if (i != kStringSearchNoMatch) {
+    match.push_back({{(uint32_t)i, RHandle->getStringLength()}});
   }
   return match;
 }
@@ -1440,7 +1479,9 @@ stringPrototypeRepeat(void *, Runtime *runtime, NativeArgs args) {
   // It's safe to multiply as the overflow check is done above.
   SafeUInt32 finalLen(strLen * n);
 
-  auto builderRes = StringBuilder::createStringBuilder(runtime, finalLen);
+  // Keep ASCII strings in ASCII, so they stay compact and fast to search.
+  auto builderRes =
+      StringBuilder::createStringBuilder(runtime, finalLen, S->isASCII());
   if (LLVM_UNLIKELY(builderRes == ExecutionStatus::EXCEPTION)) {
     return ExecutionStatus::EXCEPTION;
   }
@@ -1722,14 +1763,11 @@ stringPrototypeReplace(void *, Runtime *runtime, NativeArgs args) {
   auto strView = StringPrimitive::createStringView(runtime, string);
   if (!strView.empty()) {
     auto searchView = StringPrimitive::createStringView(runtime, searchString);
-    auto searchResult = std::search(
-        strView.begin(), strView.end(), searchView.begin(), searchView.end());
-
-    if (searchResult != strView.end()) {
-      pos = searchResult - strView.begin();
-    } else {
+    size_t found = searchStringView(strView, searchView, 0);
+    if (found == kStringSearchNoMatch) {
       return string.getHermesValue();
     }
+    pos = found;
   } else if (searchString->getStringLength() != 0) {
     // If string is empty and search is not empty, there is no match.
     return string.getHermesValue();
@@ -2113,15 +2151,8 @@ CallResult<HermesValue> stringPrototypeIncludesOrStartsWith(
   // k, return false.
   auto SView = StringPrimitive::createStringView(runtime, S);
   auto searchStrView = StringPrimitive::createStringView(runtime, searchStr);
-  auto foundIter = std::search(
-      SView.begin() + start,
-      SView.end(),
-      searchStrView.begin(),
-      searchStrView.end());
-  // Note: searchStrView.empty check is needed in the special case that S is
-  // empty, searchStr is empty, and start = 0
   return HermesValue::encodeBoolValue(
-      foundIter != SView.end() || searchStrView.empty());
+      searchStringView(SView, searchStrView, start) != kStringSearchNoMatch);
 }
 
 /// Shared implementation of string.indexOf and string.lastIndexOf
@@ -2185,33 +2216,11 @@ stringDirectedIndexOf(Runtime *runtime, NativeArgs args, bool reverse) {
   double len = S->getStringLength();
   uint32_t start = static_cast<uint32_t>(std::min(std::max(pos, 0.), len));
 
-  // TODO: good candidate for Boyer-Moore on large needles/haystacks
-  // TODO: good candidate for memchr on length-1 needles
   auto SView = StringPrimitive::createStringView(runtime, S);
   auto searchStrView = StringPrimitive::createStringView(runtime, searchStr);
-  double ret = -1;
-  if (reverse) {
-    uint32_t lastPossibleMatchEnd =
-        std::min(SView.length(), start + searchStrView.length());
-    auto foundIter = std::search(
-        SView.rbegin() + (SView.length() - lastPossibleMatchEnd),
-        SView.rend(),
-        searchStrView.rbegin(),
-        searchStrView.rend());
-    if (foundIter != SView.rend() || searchStrView.empty()) {
-      ret = SView.rend() - foundIter - searchStrView.length();
-    }
-  } else {
-    auto foundIter = std::search(
-        SView.begin() + start,
-        SView.end(),
-        searchStrView.begin(),
-        searchStrView.end());
-    if (foundIter != SView.end() || searchStrView.empty()) {
-      ret = foundIter - SView.begin();
-    }
-  }
-  return HermesValue::encodeDoubleValue(ret);
+  size_t found = searchStringView(SView, searchStrView, start, reverse);
+  return HermesValue::encodeDoubleValue(
+      found == kStringSearchNoMatch ? -1 : static_cast<double>(found));
 }
 
 CallResult<HermesValue>
@@ -265,10 +265,8 @@ CallResult<HermesValue> mapFilterLoop(
   return HermesValue::encodeNumberValue(insert);
 }
 
-/// This is the sort model for use with TypedArray.prototype.sort.
-/// template param \p WithCompareFn should be true if the compare function is
-/// a valid callback to call, and false if it is null or undefined.
-template <bool WithCompareFn>
+/// This is the sort model for use with TypedArray.prototype.sort with a
+/// compare function. Without one, sortTypedArrayElements() is used instead.
 class TypedArraySortModel : public SortModel {
  protected:
   /// Runtime to sort in.
@@ -278,7 +276,6 @@ class TypedArraySortModel : public SortModel {
   GCScope gcScope_;
 
   /// JS comparison function, return -1 for less, 0 for equal, 1 for greater.
-  /// If null, then use the built in < operator.
   Handle<Callable> compareFn_;
 
   /// Object to sort.
@@ -324,16 +321,6 @@ class TypedArraySortModel : public SortModel {
     GCScopeMarkerRAII gcMarker{gcScope_, gcMarker_};
     HermesValue aVal = JSObject::getOwnIndexed(*self_, runtime_, a);
     HermesValue bVal = JSObject::getOwnIndexed(*self_, runtime_, b);
-    if (!WithCompareFn) {
-      double a = aVal.getNumber();
-      double b = bVal.getNumber();
-      if (LLVM_UNLIKELY(a == 0) && LLVM_UNLIKELY(b == 0) &&
-          LLVM_UNLIKELY(std::signbit(a)) && LLVM_UNLIKELY(!std::signbit(b))) {
-        // -0 < +0, according to the spec.
-        return true;
-      }
-      return a < b;
-    }
     assert(compareFn_ && "Cannot use this version if the compareFn is null");
     // ES7 22.2.3.26 2a.
     // Let v be toNumber_RJS(Call(comparefn, undefined, x, y)).
@@ -356,6 +343,101 @@ class TypedArraySortModel : public SortModel {
   }
 };
 
+/// Sort the raw elements in [\p begin, \p end) the way
+/// TypedArray.prototype.sort does without a compare function: ascending, with
+/// -0 before +0 and NaNs at the end.
+template <typename T>
+void sortTypedArrayElements(T *begin, T *end) {
+  if (sizeof(T) == 1) {
+    // Count the occurrences of each of the 256 values, then write them back in
+    // order.
+    size_t counts[256] = {};
+    for (T *it = begin; it != end; ++it)
+      ++counts[static_cast<uint8_t>(*it)];
+    T *out = begin;
+    for (int v = std::numeric_limits<T>::min();
+         v <= std::numeric_limits<T>::max();
+         ++v) {
+      out = std::fill_n(out, counts[static_cast<uint8_t>(v)], v);
+    }
+    return;
+  }
+  if (std::is_floating_point<T>::value) {
+    // NaN is unordered, so move all of them to the end first.
+    end = std::partition(begin, end, [](T x) { return !std::isnan(x); });
+    std::sort(begin, end, [](T a, T b) {
+      if (LLVM_UNLIKELY(a == 0) && LLVM_UNLIKELY(b == 0)) {
+        // -0 < +0, according to the spec.
+        return std::signbit(a) && !std::signbit(b);
+      }
+      return a < b;
+    });
+    return;
+  }
+  std::sort(begin, end);
+}
+
+/// Convert \p number to the element type T if T can represent it exactly.
+/// \return true if it could, with the element in \p result.
+template <typename T>
+bool toExactElement(double number, T &result) {
+  // Compare with the range first, since converting a number outside of it is
+  // undefined. Infinities are in the range of the floating point types.
+  if (!(number >= std::numeric_limits<T>::lowest() &&
+        number <= std::numeric_limits<T>::max()) &&
+      !(std::is_floating_point<T>::value && std::isinf(number))) {
+    return false;
+  }
+  result = static_cast<T>(number);
+  return result == number;
+}
+
+/// Search the raw elements of \p arr for \p searchElement, starting at
+/// index \p k and moving towards the end, or towards the beginning if
+/// \p backward. NaN is only found if \p sameValueZero, like
+/// TypedArray.prototype.includes does. Equal elements compare equal
+/// regardless of the sign of zero.
+/// \return the index of the element found, or -1 if it isn't there.
+template <typename T, CellKind C>
+double typedArrayIndexOf(
+    Runtime *runtime,
+    JSTypedArrayBase *arr,
+    double k,
+    double searchElement,
+    bool backward,
+    bool sameValueZero) {
+  auto *typedArr = vmcast<JSTypedArray<T, C>>(arr);
+  T *begin = typedArr->begin(runtime);
+  T *end = typedArr->end(runtime);
+  if (backward ? k < 0 : k >= typedArr->getLength())
+    return -1;
+  const auto start = static_cast<JSTypedArrayBase::size_type>(k);
+
+  if (LLVM_UNLIKELY(std::isnan(searchElement))) {
+    if (!sameValueZero || !std::is_floating_point<T>::value)
+      return -1;
+    auto isNaN = [](T x) { return std::isnan(x); };
+    if (backward) {
+      auto rbegin = std::reverse_iterator<T *>(begin + start + 1);
+      auto it = std::find_if(rbegin, std::reverse_iterator<T *>(begin), isNaN);
+      return it.base() == begin ? -1 : it.base() - begin - 1;
+    }
+    auto it = std::find_if(begin + start, end, isNaN);
+    return it == end ? -1 : it - begin;
+  }
+
+  T element;
+  if (!toExactElement(searchElement, element))
+    return -1;
+  if (backward) {
+    auto rbegin = std::reverse_iterator<T *>(begin + start + 1);
+    auto it = std::find(rbegin, std::reverse_iterator<T *>(begin), element);
+    return it.base() == begin ? -1 : it.base() - begin - 1;
+  }
+  auto it = std::find(begin + start, end, element);
+  return it == end ? -1 : it - begin;
+}
+
 // ES7 22.2.3.23.1
 CallResult<HermesValue> typedArrayPrototypeSetObject(
     Runtime *runtime,
@@ -433,13 +515,22 @@ CallResult<HermesValue> typedArrayPrototypeSetTypedArray(
     }
     return HermesValue::encodeUndefinedValue();
   }
+  if (self->getKind() == src->getKind()) {
+    // Elements of the same type can be moved within the buffer directly, even
+    // if the source and the destination overlap.
+    std::memmove(
+        self->begin(runtime) +
+            static_cast<JSTypedArrayBase::size_type>(offset) *
+                self->getByteWidth(),
+        src->begin(runtime),
+        srcLength * src->getByteWidth());
+    return HermesValue::encodeUndefinedValue();
+  }
   // 23. If SameValue(srcBuffer, targetBuffer) is true, then
   // a. Let srcBuffer be ? CloneArrayBuffer(targetBuffer, srcByteOffset,
   // %ArrayBuffer%).
-  // If the two arrays have overlapping storage, make a copy of the source
-  // array.
-  // TODO: This could be implemented via a directional copy which either
-  // copies forwards or backwards depending on how the regions overlap.
+  // If the two arrays have overlapping storage and different element types,
+  // make a copy of the source array.
   auto possibleTA = JSTypedArrayBase::allocate(src, runtime, srcLength);
   if (possibleTA == ExecutionStatus::EXCEPTION) {
     return ExecutionStatus::EXCEPTION;
@@ -1023,24 +1114,28 @@ typedArrayPrototypeIndexOf(void *ctx, Runtime *runtime, NativeArgs args) {
   } else {
     k = fromIndex >= 0 ? fromIndex : std::max(len + fromIndex, 0.0);
   }
-  auto delta = indexOfMode == IndexOfMode::lastIndexOf ? -1 : 1;
-  auto inRange = [indexOfMode](double k, double len) {
-    if (indexOfMode == IndexOfMode::lastIndexOf) {
-      return k >= 0;
-    } else {
-      return k < len;
-    }
-  };
-  for (; inRange(k, len); k += delta) {
-    auto curr = JSObject::getOwnIndexed(*self, runtime, k);
-    bool comp = indexOfMode == IndexOfMode::includes
-        ? isSameValueZero(curr, searchElement)
-        : strictEqualityTest(curr, searchElement);
-    if (comp) {
-      return ret(true, k);
-    }
+  if (!self->attached(runtime)) {
+    // A detached TypedArray has no elements to find.
+    return ret();
+  }
+  // Compare the raw elements instead of encoding each one as a HermesValue.
+  double index;
+  switch (self->getKind()) {
+#define TYPED_ARRAY(name, type)                                  \
+  case CellKind::name##ArrayKind:                                \
+    index = typedArrayIndexOf<type, CellKind::name##ArrayKind>(  \
+        runtime,                                                 \
+        *self,                                                   \
+        k,                                                       \
+        searchElement.getNumber(),                               \
+        indexOfMode == IndexOfMode::lastIndexOf,                 \
+        indexOfMode == IndexOfMode::includes);                   \
+    break;
+#include "hermes/VM/TypedArrays.def"
+    default:
+      llvm_unreachable("Invalid TypedArray after ValidateTypedArray call");
   }
-  return ret();
+  return index < 0 ? ret() : ret(true, index);
 }
 
 CallResult<HermesValue>
@@ -1278,22 +1373,17 @@ typedArrayPrototypeReverse(void *, Runtime *runtime, NativeArgs args) {
     return ExecutionStatus::EXCEPTION;
   }
   auto self = args.vmcastThis<JSTypedArrayBase>();
-  const JSTypedArrayBase::size_type len = self->getLength();
-  const JSTypedArrayBase::size_type middle = len / 2;
-  MutableHandle<> lowerHandle(runtime);
-  MutableHandle<> upperHandle(runtime);
-  for (JSTypedArrayBase::size_type lower = 0; lower != middle; ++lower) {
-    auto upper = len - lower - 1;
-    lowerHandle = JSObject::getOwnIndexed(*self, runtime, lower);
-    upperHandle = JSObject::getOwnIndexed(*self, runtime, upper);
-    if (JSObject::setOwnIndexed(self, runtime, lower, upperHandle) ==
-        ExecutionStatus::EXCEPTION) {
-      return ExecutionStatus::EXCEPTION;
-    }
-    if (JSObject::setOwnIndexed(self, runtime, upper, lowerHandle) ==
-        ExecutionStatus::EXCEPTION) {
-      return ExecutionStatus::EXCEPTION;
-    }
+  // Swap the raw elements, which also preserves the bits of NaNs.
+  switch (self->getKind()) {
+#define TYPED_ARRAY(name, type)                                              \
+  case CellKind::name##ArrayKind: {                                          \
+    auto *arr = vmcast<JSTypedArray<type, CellKind::name##ArrayKind>>(*self); \
+    std::reverse(arr->begin(runtime), arr->end(runtime));                    \
+    break;                                                                   \
+  }
+#include "hermes/VM/TypedArrays.def"
+    default:
+      llvm_unreachable("Invalid TypedArray after ValidateTypedArray call");
   }
   return self.getHermesValue();
 }
@@ -1314,18 +1404,29 @@ typedArrayPrototypeSort(void *, Runtime *runtime, NativeArgs args) {
     return runtime->raiseTypeError("TypedArray sort argument must be callable");
   }
 
+  if (!compareFn) {
+    // Without a compare function nothing can run JS or allocate, so sort the
+    // raw elements directly.
+    switch (self->getKind()) {
+#define TYPED_ARRAY(name, type)                                               \
+  case CellKind::name##ArrayKind: {                                           \
+    auto *arr = vmcast<JSTypedArray<type, CellKind::name##ArrayKind>>(*self); \
+    sortTypedArrayElements(arr->begin(runtime), arr->end(runtime));           \
+    break;                                                                    \
+  }
+#include "hermes/VM/TypedArrays.def"
+      default:
+        llvm_unreachable("Invalid TypedArray after ValidateTypedArray call");
+    }
+    return self.getHermesValue();
+  }
+
   // Use our custom sort routine. We can't use std::sort because it performs
   // optimizations that allow it to bypass calls to std::swap, but our swap
   // function is special, since it needs to use the internal Object functions.
-  if (compareFn) {
-    TypedArraySortModel<true> sm(runtime, self, compareFn);
-    if (LLVM_UNLIKELY(quickSort(&sm, 0, len) == ExecutionStatus::EXCEPTION))
-      return ExecutionStatus::EXCEPTION;
-  } else {
-    TypedArraySortModel<false> sm(runtime, self, compareFn);
-    if (LLVM_UNLIKELY(quickSort(&sm, 0, len) == ExecutionStatus::EXCEPTION))
-      return ExecutionStatus::EXCEPTION;
-  }
+  TypedArraySortModel sm(runtime, self, compareFn);
+  if (LLVM_UNLIKELY(quickSort(&sm, 0, len) == ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
   return self.getHermesValue();
 }
 
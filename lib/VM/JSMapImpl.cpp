@@ -115,7 +115,6 @@ void JSMapIteratorImpl<C>::MapOrSetIteratorBuildMeta(
   ObjectBuildMeta(cell, mb);
   const auto *self = static_cast<const JSMapIteratorImpl<C> *>(cell);
   mb.addField("data", &self->data_);
-  mb.addField("itr", &self->itr_);
 }
 
 void MapIteratorBuildMeta(const GCCell *cell, Metadata::Builder &mb) {
@@ -135,7 +134,9 @@ void serializeMapOrSetIteratorImpl(Serializer &s, const GCCell *cell) {
   JSObject::serializeObjectImpl(
       s, cell, JSObject::numOverlapSlots<JSMapIteratorImpl<C>>());
   s.writeRelocation(self->data_.get(s.getRuntime()));
-  s.writeRelocation(self->itr_.get(s.getRuntime()));
+  s.writeInt<uint64_t>(self->pos_.seq);
+  s.writeInt<uint32_t>(self->pos_.index);
+  s.writeInt<uint32_t>(self->pos_.epoch);
   s.writeInt<uint8_t>((uint8_t)self->iterationKind_);
   s.writeInt<uint8_t>(self->iterationFinished_);
 }
@@ -144,7 +145,9 @@ template <CellKind C>
 JSMapIteratorImpl<C>::JSMapIteratorImpl(Deserializer &d)
     : JSObject(d, &vt.base) {
   d.readRelocation(&data_, RelocationKind::GCPointer);
-  d.readRelocation(&itr_, RelocationKind::GCPointer);
+  pos_.seq = d.readInt<uint64_t>();
+  pos_.index = d.readInt<uint32_t>();
+  pos_.epoch = d.readInt<uint32_t>();
   iterationKind_ = (IterationKind)d.readInt<uint8_t>();
   iterationFinished_ = d.readInt<uint8_t>();
 }
@@ -166,6 +166,14 @@ PseudoHandle<JSObject> JSObject::create(
       JSObject::allocatePropStorage(std::move(self), runtime, propertyCount));
 }
 
+PseudoHandle<JSObject> JSObject::create(
+    Runtime *runtime,
+    Handle<JSObject> parentHandle,
+    unsigned propertyCount) {
+  return runtime->ignoreAllocationFailure(JSObject::allocatePropStorage(
+      create(runtime, parentHandle), runtime, propertyCount));
+}
+
 PseudoHandle<JSObject> JSObject::create(
     Runtime *runtime,
     Handle<HiddenClass> clazz) {
@@ -898,7 +906,10 @@ JSObject *JSObject::getNamedDescriptor(
     Runtime *runtime,
     SymbolID name,
     PropertyFlags expectedFlags,
-    NamedPropertyDescriptor &desc) {
+    NamedPropertyDescriptor &desc,
+    uint32_t *protoDepth) {
+  if (protoDepth)
+    *protoDepth = 0;
   if (findProperty(selfHandle, runtime, name, expectedFlags, desc))
     return *selfHandle;
 
@@ -935,6 +946,7 @@ JSObject *JSObject::getNamedDescriptor(
     MutableHandle<JSObject> mutableSelfHandle{
         runtime, selfHandle->parent_.getNonNull(runtime)};
 
+    uint32_t depth = 1;
     do {
       // Check the most common case first, at the cost of some code duplication.
       if (LLVM_LIKELY(
@@ -951,6 +963,8 @@ JSObject *JSObject::getNamedDescriptor(
           assert(
               !selfHandle->flags_.proxyObject &&
               "Proxy object parents should never have own properties");
+          if (protoDepth)
+            *protoDepth = depth;
           return *mutableSelfHandle;
         }
       } else if (LLVM_UNLIKELY(mutableSelfHandle->flags_.lazyObject)) {
@@ -967,6 +981,7 @@ JSObject *JSObject::getNamedDescriptor(
         desc.flags.proxyObject = true;
         return *mutableSelfHandle;
       }
+      ++depth;
     } while ((mutableSelfHandle = mutableSelfHandle->parent_.get(runtime)));
   }
 
@@ -1046,9 +1061,11 @@ CallResult<PseudoHandle<>> JSObject::getNamedWithReceiver_RJS(
     PropOpFlags opFlags,
     PropertyCacheEntry *cacheEntry) {
   NamedPropertyDescriptor desc;
+  uint32_t protoDepth;
   // Locate the descriptor. propObj contains the object which may be anywhere
   // along the prototype chain.
-  JSObject *propObj = getNamedDescriptor(selfHandle, runtime, name, desc);
+  JSObject *propObj = getNamedDescriptor(
+      selfHandle, runtime, name, PropertyFlags::invalid(), desc, &protoDepth);
   if (!propObj) {
     if (LLVM_UNLIKELY(opFlags.getMustExist())) {
       return runtime->raiseReferenceError(
@@ -1066,6 +1083,7 @@ CallResult<PseudoHandle<>> JSObject::getNamedWithReceiver_RJS(
     if (cacheEntry && !propObj->getClass(runtime)->isDictionaryNoCache()) {
       cacheEntry->clazz = propObj->getClassGCPtr().getStorageType();
       cacheEntry->slot = desc.slot;
+      cacheEntry->protoDepth = protoDepth;
     }
     return createPseudoHandle(getNamedSlotValue(propObj, runtime, desc));
   }
@@ -2566,6 +2584,14 @@ void JSObject::updatePropertyFlagsWithoutTransitions(
   selfHandle->clazz_.set(runtime, *newClazz, &runtime->getHeap());
 }
 
+void JSObject::makeDictionaryAlwaysCacheable(
+    Handle<JSObject> selfHandle,
+    Runtime *runtime) {
+  auto newClazz = HiddenClass::copyToAlwaysCacheableDictionary(
+      runtime->makeHandle(selfHandle->clazz_), runtime);
+  selfHandle->clazz_.set(runtime, *newClazz, &runtime->getHeap());
+}
+
 CallResult<bool> JSObject::isExtensible(
     PseudoHandle<JSObject> self,
     Runtime *runtime) {
@@ -204,6 +204,35 @@ ExecutionStatus JSTypedArrayBase::setToCopyOfBuffer(
   return ExecutionStatus::RETURNED;
 }
 
+/// Convert \p count raw elements of \p src starting at \p srcIndex to the
+/// element type T of \p dst, and store them starting at \p dstIndex.
+template <typename T, CellKind C>
+static void copyConvertedElements(
+    Runtime *runtime,
+    JSTypedArray<T, C> *dst,
+    JSTypedArrayBase::size_type dstIndex,
+    JSTypedArrayBase *src,
+    JSTypedArrayBase::size_type srcIndex,
+    JSTypedArrayBase::size_type count) {
+  T *out = dst->begin(runtime) + dstIndex;
+  switch (src->getKind()) {
+#define TYPED_ARRAY(name, type)                                          \
+  case CellKind::name##ArrayKind: {                                      \
+    const type *in =                                                     \
+        vmcast<JSTypedArray<type, CellKind::name##ArrayKind>>(src)->begin( \
+            runtime) +                                                   \
+        srcIndex;                                                        \
+    for (JSTypedArrayBase::size_type i = 0; i < count; ++i) {            \
+      out[i] = JSTypedArray<T, C>::toDestType(in[i]);                    \
+    }                                                                    \
+    break;                                                               \
+  }
+#include "hermes/VM/TypedArrays.def"
+    default:
+      llvm_unreachable("Invalid TypedArray kind");
+  }
+}
+
 ExecutionStatus JSTypedArrayBase::setToCopyOfTypedArray(
     Runtime *runtime,
     Handle<JSTypedArrayBase> dst,
@@ -225,14 +254,21 @@ ExecutionStatus JSTypedArrayBase::setToCopyOfTypedArray(
     JSTypedArrayBase::setToCopyOfBytes(
         runtime, dst, dstIndex, src, srcIndex, count);
   } else {
-    // Else must do type conversions.
-    MutableHandle<> storage(runtime);
-    for (auto k = srcIndex; k < srcIndex + count; ++k) {
-      storage = JSObject::getOwnIndexed(*src, runtime, k);
-      if (JSObject::setOwnIndexed(dst, runtime, dstIndex++, storage) ==
-          ExecutionStatus::EXCEPTION) {
-        return ExecutionStatus::EXCEPTION;
-      }
+    // Else must do type conversions, which can't run JS or allocate.
+    switch (dst->getKind()) {
+#define TYPED_ARRAY(name, type)                                             \
+  case CellKind::name##ArrayKind:                                           \
+    copyConvertedElements(                                                  \
+        runtime,                                                            \
+        vmcast<JSTypedArray<type, CellKind::name##ArrayKind>>(*dst),        \
+        dstIndex,                                                           \
+        *src,                                                               \
+        srcIndex,                                                           \
+        count);                                                             \
+    break;
+#include "hermes/VM/TypedArrays.def"
+      default:
+        llvm_unreachable("Invalid TypedArray kind");
     }
   }
   return ExecutionStatus::RETURNED;
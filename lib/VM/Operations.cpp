@@ -23,8 +23,6 @@
 #include "hermes/VM/StringPrimitive.h"
 #include "hermes/VM/StringView.h"
 
-#include "dtoa/dtoa.h"
-
 #include "llvm/ADT/SmallString.h"
 
 #include <cfloat>
@@ -280,6 +278,8 @@ static CallResult<PseudoHandle<StringPrimitive>> numberToString(
   // Optimization: Fast-case for positive integers < 2^31
   int32_t n = static_cast<int32_t>(m);
   if (m == static_cast<double>(n) && n > 0) {
+    if (static_cast<uint32_t>(n) < Runtime::kNumSmallIntStrings)
+      return createPseudoHandle(runtime->getSmallIntString(n).get());
     // Write base 10 digits in reverse from end of buf8.
     char *p = buf8 + sizeof(buf8);
     do {
@@ -378,6 +378,7 @@ static inline double stringToNumber(
   }
   if (runtime->symbolEqualsToStringPrim(
           Predefined::getSymbolID(Predefined::NegativeInfinity), *strPrim)) {
+    return -std::numeric_limits<double>::infinity();
   }
   if (runtime->symbolEqualsToStringPrim(
           Predefined::getSymbolID(Predefined::NaN), *strPrim)) {
@@ -443,24 +444,16 @@ static inline double stringToNumber(
     }
   }
 
-  // Finally, copy 16 bit chars into 8 bit chars and call dtoa.
-  llvm::SmallVector<char, 32> str8(len + 1);
-  uint32_t i = 0;
-  for (auto c16 : str16) {
-    // Check to ensure we only have valid number characters now.
-    if ((u'0' <= c16 && c16 <= u'9') || c16 == u'.' ||
-        letterToLower(c16) == u'e' || c16 == u'+' || c16 == u'-') {
-      str8[i] = static_cast<char>(c16);
-    } else {
-      return std::numeric_limits<double>::quiet_NaN();
-    }
-    ++i;
-  }
-  str8[len] = '\0';
-  char *endPtr;
-  double result = ::hermes_g_strtod(str8.data(), &endPtr);
-  if (endPtr == str8.data() + len) {
-    return result;
+  // Finally, parse the whole string as a decimal number.
+  double result;
+  if (str16.isASCII()) {
+    const char *chars = str16.castToCharPtr();
+    if (parseDecimalPrefix(chars, chars + len, result) == chars + len)
+      return result;
+  } else {
+    const char16_t *chars = str16.castToChar16Ptr();
+    if (parseDecimalPrefix(chars, chars + len, result) == chars + len)
+      return result;
   }
 
   // If everything failed, return NaN.
@@ -10,6 +10,7 @@
 #include "hermes/Support/ErrorHandling.h"
 #include "hermes/VM/BuildMetadata.h"
 #include "hermes/VM/GCPointer-inline.h"
+#include "hermes/VM/HermesValue-inline.h"
 #include "hermes/VM/Operations.h"
 
 #include "llvm/Support/Debug.h"
@@ -17,53 +18,6 @@
 
 namespace hermes {
 namespace vm {
-//===----------------------------------------------------------------------===//
-// class HashMapEntry
-
-VTable HashMapEntry::vt{CellKind::HashMapEntryKind, cellSize<HashMapEntry>()};
-
-void HashMapEntryBuildMeta(const GCCell *cell, Metadata::Builder &mb) {
-  const auto *self = static_cast<const HashMapEntry *>(cell);
-  mb.addField("key", &self->key);
-  mb.addField("value", &self->value);
-  mb.addField("prevIterationEntry", &self->prevIterationEntry);
-  mb.addField("nextIterationEntry", &self->nextIterationEntry);
-  mb.addField("nextEntryInBucket", &self->nextEntryInBucket);
-}
-
-#ifdef HERMESVM_SERIALIZE
-HashMapEntry::HashMapEntry(Deserializer &d)
-    : GCCell(&d.getRuntime()->getHeap(), &vt) {
-  d.readHermesValue(&key);
-  d.readHermesValue(&value);
-  d.readRelocation(&prevIterationEntry, RelocationKind::GCPointer);
-  d.readRelocation(&nextIterationEntry, RelocationKind::GCPointer);
-  d.readRelocation(&nextEntryInBucket, RelocationKind::GCPointer);
-}
-
-void HashMapEntrySerialize(Serializer &s, const GCCell *cell) {
-  auto *self = vmcast<const HashMapEntry>(cell);
-  s.writeHermesValue(self->key);
-  s.writeHermesValue(self->value);
-  s.writeRelocation(self->prevIterationEntry.get(s.getRuntime()));
-  s.writeRelocation(self->nextIterationEntry.get(s.getRuntime()));
-  s.writeRelocation(self->nextEntryInBucket.get(s.getRuntime()));
-  s.endObject(cell);
-}
-
-void HashMapEntryDeserialize(Deserializer &d, CellKind kind) {
-  assert(kind == CellKind::HashMapEntryKind && "Expected HashMapEntry");
-  void *mem = d.getRuntime()->alloc(cellSize<HashMapEntry>());
-  auto *cell = new (mem) HashMapEntry(d);
-  d.endObject(cell);
-}
-#endif
-
-CallResult<HermesValue> HashMapEntry::create(Runtime *runtime) {
-  void *mem = runtime->alloc(cellSize<HashMapEntry>());
-  return HermesValue::encodeObjectValue(new (mem) HashMapEntry(runtime));
-}
-
 //===----------------------------------------------------------------------===//
 // class OrderedHashMap
 
@@ -73,41 +27,28 @@ VTable OrderedHashMap::vt{CellKind::OrderedHashMapKind,
 void OrderedHashMapBuildMeta(const GCCell *cell, Metadata::Builder &mb) {
   const auto *self = static_cast<const OrderedHashMap *>(cell);
   mb.addField("hashTable", &self->hashTable_);
-  mb.addField("firstIterationEntry", &self->firstIterationEntry_);
-  mb.addField("lastIterationEntry", &self->lastIterationEntry_);
+  mb.addField("entries", &self->entries_);
 }
 
 #ifdef HERMESVM_SERIALIZE
 OrderedHashMap::OrderedHashMap(Deserializer &d)
     : GCCell(&d.getRuntime()->getHeap(), &vt) {
-  if (d.readInt<uint8_t>()) {
-    hashTable_.set(
-        d.getRuntime(),
-        ArrayStorage::deserializeArrayStorage(d),
-        &d.getRuntime()->getHeap());
-  }
-
-  d.readRelocation(&firstIterationEntry_, RelocationKind::GCPointer);
-  d.readRelocation(&lastIterationEntry_, RelocationKind::GCPointer);
+  d.readRelocation(&hashTable_, RelocationKind::GCPointer);
+  d.readRelocation(&entries_, RelocationKind::GCPointer);
   capacity_ = d.readInt<uint32_t>();
   size_ = d.readInt<uint32_t>();
+  epoch_ = d.readInt<uint32_t>();
+  nextSeq_ = d.readInt<uint64_t>();
 }
 
 void OrderedHashMapSerialize(Serializer &s, const GCCell *cell) {
   auto *self = vmcast<const OrderedHashMap>(cell);
-  // If we have an ArrayStorage, it doesn't store any native pointers. Serialize
-  // it here.
-  bool hasArray = (bool)self->hashTable_;
-  s.writeInt<uint8_t>(hasArray);
-  if (hasArray) {
-    ArrayStorage::serializeArrayStorage(
-        s, self->hashTable_.get(s.getRuntime()));
-  }
-
-  s.writeRelocation(self->firstIterationEntry_.get(s.getRuntime()));
-  s.writeRelocation(self->lastIterationEntry_.get(s.getRuntime()));
+  s.writeRelocation(self->hashTable_.get(s.getRuntime()));
+  s.writeRelocation(self->entries_.get(s.getRuntime()));
   s.writeInt<uint32_t>(self->capacity_);
   s.writeInt<uint32_t>(self->size_);
+  s.writeInt<uint32_t>(self->epoch_);
+  s.writeInt<uint64_t>(self->nextSeq_);
 
   s.endObject(cell);
 }
@@ -123,136 +64,128 @@ void OrderedHashMapDeserialize(Deserializer &d, CellKind kind) {
 
 OrderedHashMap::OrderedHashMap(
     Runtime *runtime,
-    Handle<ArrayStorage> hashTableStorage)
+    Handle<SegmentedArray> hashTableStorage,
+    Handle<SegmentedArray> entriesStorage)
     : GCCell(&runtime->getHeap(), &vt),
-      hashTable_(runtime, hashTableStorage.get(), &runtime->getHeap()) {}
+      hashTable_(runtime, hashTableStorage.get(), &runtime->getHeap()),
+      entries_(runtime, entriesStorage.get(), &runtime->getHeap()) {}
 
 CallResult<HermesValue> OrderedHashMap::create(Runtime *runtime) {
-  auto arrRes =
-      ArrayStorage::create(runtime, INITIAL_CAPACITY, INITIAL_CAPACITY);
-  if (LLVM_UNLIKELY(arrRes == ExecutionStatus::EXCEPTION)) {
+  auto tableRes =
+      SegmentedArray::create(runtime, INITIAL_CAPACITY, INITIAL_CAPACITY);
+  if (LLVM_UNLIKELY(tableRes == ExecutionStatus::EXCEPTION)) {
     return ExecutionStatus::EXCEPTION;
   }
-  auto hashTableStorage = runtime->makeHandle<ArrayStorage>(*arrRes);
+  auto hashTableStorage = runtime->makeHandle(std::move(*tableRes));
+  // Many maps stay empty, so only allocate room for the entries on the first
+  // insertion.
+  auto entriesRes = SegmentedArray::create(runtime, 0);
+  if (LLVM_UNLIKELY(entriesRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  auto entriesStorage = runtime->makeHandle(std::move(*entriesRes));
 
   void *mem = runtime->alloc(cellSize<OrderedHashMap>());
   return HermesValue::encodeObjectValue(
-      new (mem) OrderedHashMap(runtime, hashTableStorage));
+      new (mem) OrderedHashMap(runtime, hashTableStorage, entriesStorage));
 }
 
-void OrderedHashMap::removeLinkedListNode(
+uint32_t OrderedHashMap::lookup(
     Runtime *runtime,
-    HashMapEntry *entry,
-    GC *gc) {
+    uint32_t hash,
+    HermesValue key) const {
+  SegmentedArray *hashTable = hashTable_.getNonNull(runtime);
+  SegmentedArray *entries = entries_.getNonNull(runtime);
+  assert(hashTable->size() == capacity_ && "Inconsistent capacity");
   assert(
-      entry != lastIterationEntry_.get(runtime) &&
-      "Cannot remove the last entry");
-  if (entry->prevIterationEntry) {
-    entry->prevIterationEntry.get(runtime)->nextIterationEntry.set(
-        runtime, entry->nextIterationEntry, gc);
-  }
-  if (entry->nextIterationEntry) {
-    entry->nextIterationEntry.get(runtime)->prevIterationEntry.set(
-        runtime, entry->prevIterationEntry, gc);
-  }
-  if (entry == firstIterationEntry_.get(runtime)) {
-    firstIterationEntry_.set(runtime, entry->nextIterationEntry, gc);
+      (capacity_ & (capacity_ - 1)) == 0 && "capacity_ must be power of 2");
+  const uint32_t mask = capacity_ - 1;
+  // The load factor is at most 0.75, so there is always an empty slot.
+  for (uint32_t slot = hash & mask, step = 1;; slot = (slot + step++) & mask) {
+    HermesValue index = hashTable->at(slot);
+    if (index.isEmpty()) {
+      return slot;
+    }
+    HermesValue entryKey =
+        entries->at(index.getNativeUInt32() * ENTRY_SIZE + KEY_OFFSET);
+    // Deleted entries have an empty key, and never match.
+    if (!entryKey.isEmpty() && isSameValueZero(entryKey, key)) {
+      return slot;
+    }
   }
-  entry->prevIterationEntry.setNull(&runtime->getHeap());
 }
 
-HashMapEntry *OrderedHashMap::lookupInBucket(
-    Runtime *runtime,
-    uint32_t bucket,
-    HermesValue key) {
-  assert(
-      hashTable_.get(runtime)->size() == capacity_ && "Inconsistent capacity");
-  auto *entry = dyn_vmcast<HashMapEntry>(hashTable_.get(runtime)->at(bucket));
-  while (entry && !isSameValueZero(entry->key, key)) {
-    entry = entry->nextEntryInBucket.get(runtime);
+uint32_t OrderedHashMap::capacityFor(uint32_t count) {
+  static_assert(
+      MAX_CAPACITY < UINT32_MAX / 4,
+      "Avoid overflow checks on multiplying capacity by 2");
+  uint32_t capacity = INITIAL_CAPACITY;
+  while (capacity < count * 2 && capacity <= MAX_CAPACITY / 2) {
+    capacity *= 2;
   }
-  return entry;
+  return capacity;
 }
 
-ExecutionStatus OrderedHashMap::rehashIfNecessary(
+ExecutionStatus OrderedHashMap::rebuild(
     Handle<OrderedHashMap> self,
-    Runtime *runtime) {
-  uint32_t newCapacity = self->capacity_;
-  // NOTE: we have ensured that self->capacity_ * 4 never overflows uint32_t by
-  // setting MAX_CAPACITY to the apropriate value. self->size_ is always <=
-  // self->capacity_, so this applies to self->size_ as well.
-  static_assert(
-      MAX_CAPACITY < UINT32_MAX / 4,
-      "Avoid overflow checks on multiplying capacity by 4");
-  if (self->size_ * 4 > self->capacity_ * 3) {
-    // Load factor is more than 0.75, need to increase the capacity.
-    newCapacity = self->capacity_ * 2;
-    if (LLVM_UNLIKELY(newCapacity > MAX_CAPACITY)) {
-      // We maintain the invariant that the capacity_ is a power of two.
-      // Therefore, if doubling would exceed the max, we revert to the
-      // previous value.  (Assert the invariant to make it clear.)
-      assert(
-          (self->capacity_ & (self->capacity_ - 1)) == 0 &&
-          "capacity_ must be power of 2");
-      newCapacity = self->capacity_;
-    }
-  } else if (
-      self->size_ * 4 < self->capacity_ && self->capacity_ > INITIAL_CAPACITY) {
-    // Load factor is less than 0.25, and we are not at initial cap.
-    newCapacity = self->capacity_ / 2;
-  }
-  if (newCapacity == self->capacity_) {
-    // No need to rehash.
-    return ExecutionStatus::RETURNED;
-  }
+    Runtime *runtime,
+    uint32_t newCapacity) {
   assert(
-      self->size_ && self->firstIterationEntry_ && self->lastIterationEntry_ &&
-      "We should never be rehashing when there are no elements");
-
-  // Set new capacity first to update the hash function.
-  self->capacity_ = newCapacity;
+      usableEntries(newCapacity) >= self->size_ &&
+      "New capacity is too small for the elements");
 
   // Create a new hash table.
-  auto arrRes = ArrayStorage::create(runtime, newCapacity, newCapacity);
-  if (LLVM_UNLIKELY(arrRes == ExecutionStatus::EXCEPTION)) {
+  auto tableRes = SegmentedArray::create(runtime, newCapacity, newCapacity);
+  if (LLVM_UNLIKELY(tableRes == ExecutionStatus::EXCEPTION)) {
     return ExecutionStatus::EXCEPTION;
   }
-  auto newHashTable = runtime->makeHandle<ArrayStorage>(*arrRes);
-
-  // Now re-add all entries to the hash table.
-  MutableHandle<HashMapEntry> entry{runtime};
-  MutableHandle<HashMapEntry> oldNextInBucket{runtime};
-  MutableHandle<> keyHandle{runtime};
-  GCScopeMarkerRAII marker{runtime};
-  for (unsigned i = 0, len = self->hashTable_.get(runtime)->size(); i < len;
-       ++i) {
-    entry = dyn_vmcast<HashMapEntry>(self->hashTable_.get(runtime)->at(i));
-    while (entry) {
-      marker.flush();
-      keyHandle = entry->key;
-      uint32_t bucket = hashToBucket(self, runtime, keyHandle);
-      oldNextInBucket = entry->nextEntryInBucket.get(runtime);
-      if (newHashTable->at(bucket).isEmpty()) {
-        // Empty bucket.
-        entry->nextEntryInBucket.setNull(&runtime->getHeap());
-      } else {
-        // There are already a bucket head.
-        entry->nextEntryInBucket.set(
-            runtime,
-            vmcast<HashMapEntry>(newHashTable->at(bucket)),
-            &runtime->getHeap());
+  auto newHashTable = runtime->makeHandle(std::move(*tableRes));
+
+  const uint32_t numEntries = self->numEntries(runtime);
+  if (self->size_ != numEntries) {
+    // Copy the entries which aren't deleted, in order, leaving room for all
+    // the entries the new hash table can hold.
+    auto entriesRes = SegmentedArray::create(
+        runtime,
+        usableEntries(newCapacity) * ENTRY_SIZE,
+        self->size_ * ENTRY_SIZE);
+    if (LLVM_UNLIKELY(entriesRes == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    SegmentedArray *newEntries = entriesRes->get();
+    SegmentedArray *entries = self->entries_.getNonNull(runtime);
+    uint32_t to = 0;
+    for (uint32_t from = 0; from < numEntries * ENTRY_SIZE;
+         from += ENTRY_SIZE) {
+      if (entries->at(from + KEY_OFFSET).isEmpty()) {
+        continue;
       }
-      // Update bucket head to the new entry.
-      newHashTable->at(bucket).set(entry.getHermesValue(), &runtime->getHeap());
-
-      entry = *oldNextInBucket;
+      for (uint32_t i = 0; i < ENTRY_SIZE; ++i) {
+        newEntries->at(to + i).set(entries->at(from + i), &runtime->getHeap());
+      }
+      to += ENTRY_SIZE;
     }
+    self->entries_.set(runtime, newEntries, &runtime->getHeap());
+    // The entries have moved, so iterators need to find their index again.
+    ++self->epoch_;
   }
 
   self->hashTable_.set(runtime, newHashTable.get(), &runtime->getHeap());
-  assert(
-      self->hashTable_.get(runtime)->size() == self->capacity_ &&
-      "Inconsistent capacity");
+  self->capacity_ = newCapacity;
+
+  // Add all entries to the new hash table. Keys are unique, so each one
+  // takes the first empty slot.
+  const uint32_t mask = newCapacity - 1;
+  MutableHandle<> keyHandle{runtime};
+  for (uint32_t index = 0; index < self->size_; ++index) {
+    keyHandle = self->keyAt(runtime, index);
+    uint32_t slot = hash(runtime, keyHandle) & mask;
+    for (uint32_t step = 1; !newHashTable->at(slot).isEmpty(); ++step) {
+      slot = (slot + step) & mask;
+    }
+    newHashTable->at(slot).setNonPtr(
+        HermesValue::encodeNativeUInt32(index), &runtime->getHeap());
+  }
   return ExecutionStatus::RETURNED;
 }
 
@@ -260,27 +193,21 @@ bool OrderedHashMap::has(
     Handle<OrderedHashMap> self,
     Runtime *runtime,
     Handle<> key) {
-  auto bucket = hashToBucket(self, runtime, key);
-  return self->lookupInBucket(runtime, bucket, key.getHermesValue());
-}
-
-HashMapEntry *OrderedHashMap::find(
-    Handle<OrderedHashMap> self,
-    Runtime *runtime,
-    Handle<> key) {
-  auto bucket = hashToBucket(self, runtime, key);
-  return self->lookupInBucket(runtime, bucket, key.getHermesValue());
+  uint32_t slot = self->lookup(runtime, hash(runtime, key), *key);
+  return !self->hashTable_.getNonNull(runtime)->at(slot).isEmpty();
 }
 
 HermesValue OrderedHashMap::get(
     Handle<OrderedHashMap> self,
     Runtime *runtime,
     Handle<> key) {
-  auto *entry = find(self, runtime, key);
-  if (!entry) {
+  uint32_t slot = self->lookup(runtime, hash(runtime, key), *key);
+  HermesValue index = self->hashTable_.getNonNull(runtime)->at(slot);
+  if (index.isEmpty()) {
     return HermesValue::encodeUndefinedValue();
   }
-  return entry->value;
+  return self->entries_.getNonNull(runtime)->at(
+      index.getNativeUInt32() * ENTRY_SIZE + VALUE_OFFSET);
 }
 
 ExecutionStatus OrderedHashMap::insert(
@@ -288,160 +215,187 @@ ExecutionStatus OrderedHashMap::insert(
     Runtime *runtime,
     Handle<> key,
     Handle<> value) {
-  uint32_t bucket = hashToBucket(self, runtime, key);
-  if (auto *entry =
-          self->lookupInBucket(runtime, bucket, key.getHermesValue())) {
+  const uint32_t keyHash = hash(runtime, key);
+  uint32_t slot = self->lookup(runtime, keyHash, *key);
+  HermesValue found = self->hashTable_.getNonNull(runtime)->at(slot);
+  if (!found.isEmpty()) {
     // Element already exists, update value and return.
-    entry->value.set(value.get(), &runtime->getHeap());
+    self->entries_.getNonNull(runtime)
+        ->at(found.getNativeUInt32() * ENTRY_SIZE + VALUE_OFFSET)
+        .set(value.get(), &runtime->getHeap());
     return ExecutionStatus::RETURNED;
   }
-  // Create a new entry, set the key and value.
-  auto crtRes = HashMapEntry::create(runtime);
-  if (LLVM_UNLIKELY(crtRes == ExecutionStatus::EXCEPTION)) {
-    return ExecutionStatus::EXCEPTION;
-  }
-  auto newMapEntry = runtime->makeHandle<HashMapEntry>(*crtRes);
-  newMapEntry->key.set(key.get(), &runtime->getHeap());
-  newMapEntry->value.set(value.get(), &runtime->getHeap());
-  auto *curBucketFront =
-      dyn_vmcast<HashMapEntry>(self->hashTable_.get(runtime)->at(bucket));
-  if (curBucketFront) {
-    // If the bucket we are inserting to is not empty, we maintain the
-    // linked list properly.
-    newMapEntry->nextEntryInBucket.set(
-        runtime, curBucketFront, &runtime->getHeap());
-  }
-  // Set the newly inserted entry as the front of this bucket chain.
-  self->hashTable_.get(runtime)->at(bucket).set(
-      newMapEntry.getHermesValue(), &runtime->getHeap());
-
-  if (!self->firstIterationEntry_) {
-    // If we are inserting the first ever element, update
-    // first iteration entry pointer.
-    self->firstIterationEntry_.set(
-        runtime, newMapEntry.get(), &runtime->getHeap());
-    self->lastIterationEntry_.set(
-        runtime, newMapEntry.get(), &runtime->getHeap());
-  } else {
-    // Connect the new entry with the last entry.
-    self->lastIterationEntry_.get(runtime)->nextIterationEntry.set(
-        runtime, newMapEntry.get(), &runtime->getHeap());
-    newMapEntry->prevIterationEntry.set(
-        runtime, self->lastIterationEntry_, &runtime->getHeap());
-
-    HashMapEntry *previousLastEntry = self->lastIterationEntry_.get(runtime);
-    self->lastIterationEntry_.set(
-        runtime, newMapEntry.get(), &runtime->getHeap());
-
-    if (previousLastEntry && previousLastEntry->isDeleted()) {
-      // If the last entry was a deleted entry, we no longer need to keep it.
-      self->removeLinkedListNode(
-          runtime, previousLastEntry, &runtime->getHeap());
+
+  uint32_t index = self->numEntries(runtime);
+  if (index == usableEntries(self->capacity_)) {
+    // The hash table is full: grow it, or just drop the deleted entries if
+    // there are enough of them.
+    uint32_t newCapacity = capacityFor(self->size_ + 1);
+    if (LLVM_UNLIKELY(usableEntries(newCapacity) <= self->size_)) {
+      return runtime->raiseRangeError("Map or Set is too large");
+    }
+    if (LLVM_UNLIKELY(
+            rebuild(self, runtime, newCapacity) ==
+            ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
     }
+    slot = self->lookup(runtime, keyHash, *key);
+    index = self->numEntries(runtime);
+  }
+
+  // Append the new entry.
+  MutableHandle<SegmentedArray> entries{runtime,
+                                        self->entries_.getNonNull(runtime)};
+  const uint32_t entryStart = index * ENTRY_SIZE;
+  if (LLVM_UNLIKELY(
+          SegmentedArray::resize(
+              entries, runtime, entryStart + ENTRY_SIZE) ==
+          ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
   }
+  self->entries_.set(runtime, entries.get(), &runtime->getHeap());
+  entries->at(entryStart + KEY_OFFSET).set(key.get(), &runtime->getHeap());
+  entries->at(entryStart + VALUE_OFFSET)
+      .set(value.get(), &runtime->getHeap());
+  entries->at(entryStart + SEQ_OFFSET)
+      .setNonPtr(
+          HermesValue::encodeNumberValue(self->nextSeq_++),
+          &runtime->getHeap());
+  self->hashTable_.getNonNull(runtime)->at(slot).setNonPtr(
+      HermesValue::encodeNativeUInt32(index), &runtime->getHeap());
 
   self->size_++;
-  return self->rehashIfNecessary(self, runtime);
+  return ExecutionStatus::RETURNED;
 }
 
 bool OrderedHashMap::erase(
     Handle<OrderedHashMap> self,
     Runtime *runtime,
     Handle<> key) {
-  uint32_t bucket = hashToBucket(self, runtime, key);
-  HashMapEntry *prevEntry = nullptr;
-  auto *entry =
-      dyn_vmcast<HashMapEntry>(self->hashTable_.get(runtime)->at(bucket));
-  while (entry && !isSameValueZero(entry->key, key.getHermesValue())) {
-    prevEntry = entry;
-    entry = entry->nextEntryInBucket.get(runtime);
-  }
-  if (!entry) {
+  uint32_t slot = self->lookup(runtime, hash(runtime, key), *key);
+  HermesValue found = self->hashTable_.getNonNull(runtime)->at(slot);
+  if (found.isEmpty()) {
     // Element does not exist.
     return false;
   }
 
-  if (prevEntry) {
-    // The entry we are deleting has a previous entry, update the link.
-    prevEntry->nextEntryInBucket.set(
-        runtime, entry->nextEntryInBucket, &runtime->getHeap());
-  } else {
-    // The entry we are erasing is the front entry in the bucket, we need
-    // to update the bucket head to the next entry in the bucket, if not
-    // any, set to empty value.
-    self->hashTable_.get(runtime)->at(bucket).set(
-        entry->nextEntryInBucket ? HermesValue::encodeObjectValue(
-                                       entry->nextEntryInBucket.get(runtime))
-                                 : HermesValue::encodeEmptyValue(),
-        &runtime->getHeap());
-  }
-
-  entry->markDeleted(runtime);
+  // Mark the entry as deleted. It keeps its slot in the hash table and its
+  // sequence number until the next rebuild.
+  SegmentedArray *entries = self->entries_.getNonNull(runtime);
+  const uint32_t entryStart = found.getNativeUInt32() * ENTRY_SIZE;
+  entries->at(entryStart + KEY_OFFSET)
+      .setNonPtr(HermesValue::encodeEmptyValue(), &runtime->getHeap());
+  entries->at(entryStart + VALUE_OFFSET)
+      .setNonPtr(HermesValue::encodeEmptyValue(), &runtime->getHeap());
   self->size_--;
 
-  // Now delete the entry from the iteration linked list.
-  // If we are deleting the last entry, don't remove it from the list yet.
-  // This will ensure that if any iterator out there is currently pointing to
-  // this entry, it will be able to follow on if we add new entries in the
-  // future.
-  if (entry != self->lastIterationEntry_.get(runtime)) {
-    self->removeLinkedListNode(runtime, entry, &runtime->getHeap());
+  if (self->size_ * 8 < self->capacity_ &&
+      self->capacity_ > INITIAL_CAPACITY) {
+    // Load factor is less than 0.125, and we are not at initial cap.
+    // Shrinking is only an optimization: if it fails, keep the current
+    // storage, which still holds every entry.
+    if (LLVM_UNLIKELY(
+            rebuild(self, runtime, capacityFor(self->size_)) ==
+            ExecutionStatus::EXCEPTION)) {
+      runtime->clearThrownValue();
+    }
   }
 
-  self->rehashIfNecessary(self, runtime);
-
   return true;
 }
 
-HashMapEntry *OrderedHashMap::iteratorNext(
+bool OrderedHashMap::iteratorNext(
     Runtime *runtime,
-    HashMapEntry *entry) const {
-  if (entry == nullptr) {
-    // Starting a new iteration from the first entry.
-    entry = firstIterationEntry_.get(runtime);
-  } else {
-    // Advance to the next entry.
-    entry = entry->nextIterationEntry.get(runtime);
+    IterationPosition &pos,
+    MutableHandle<> &key,
+    MutableHandle<> &value) const {
+  SegmentedArray *entries = entries_.getNonNull(runtime);
+  const uint32_t numEntries = entries->size() / ENTRY_SIZE;
+  auto seqAt = [entries](uint32_t index) {
+    return (uint64_t)entries->at(index * ENTRY_SIZE + SEQ_OFFSET).getNumber();
+  };
+
+  uint32_t index = pos.index;
+  if (pos.epoch != epoch_) {
+    // The entries have moved since pos was computed: find the first entry
+    // which was inserted at or after the position.
+    uint32_t low = 0;
+    uint32_t high = numEntries;
+    while (low < high) {
+      uint32_t mid = low + (high - low) / 2;
+      if (seqAt(mid) < pos.seq) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    index = low;
+  }
+
+  // Skip the deleted entries.
+  for (; index < numEntries; ++index) {
+    const uint32_t entryStart = index * ENTRY_SIZE;
+    if (!entries->at(entryStart + KEY_OFFSET).isEmpty()) {
+      key = entries->at(entryStart + KEY_OFFSET);
+      value = entries->at(entryStart + VALUE_OFFSET);
+      pos.seq = seqAt(index) + 1;
+      pos.index = index + 1;
+      pos.epoch = epoch_;
+      return true;
+    }
   }
+  pos.seq = nextSeq_;
+  pos.index = numEntries;
+  pos.epoch = epoch_;
+  return false;
+}
 
-  // Make sure the entry we returned (if not nullptr) must not be deleted.
-  while (entry && entry->isDeleted()) {
-    entry = entry->nextIterationEntry.get(runtime);
+ExecutionStatus OrderedHashMap::resetStorage(
+    Handle<OrderedHashMap> self,
+    Runtime *runtime) {
+  auto tableRes =
+      SegmentedArray::create(runtime, INITIAL_CAPACITY, INITIAL_CAPACITY);
+  if (LLVM_UNLIKELY(tableRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
   }
-  return entry;
+  auto newHashTable = runtime->makeHandle(std::move(*tableRes));
+  auto entriesRes = SegmentedArray::create(runtime, 0);
+  if (LLVM_UNLIKELY(entriesRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  self->hashTable_.set(runtime, newHashTable.get(), &runtime->getHeap());
+  self->entries_.set(runtime, entriesRes->get(), &runtime->getHeap());
+  self->capacity_ = INITIAL_CAPACITY;
+  return ExecutionStatus::RETURNED;
 }
 
-void OrderedHashMap::clear(Runtime *runtime) {
-  if (!firstIterationEntry_) {
+void OrderedHashMap::clear(Handle<OrderedHashMap> self, Runtime *runtime) {
+  if (!self->numEntries(runtime)) {
     // Empty set.
     return;
   }
 
-  // Clear the hash table.
-  for (unsigned i = 0; i < capacity_; ++i) {
-    auto entry = dyn_vmcast<HashMapEntry>(hashTable_.get(runtime)->at(i));
-    // Delete every element reachable from the hash table.
-    while (entry) {
-      entry->markDeleted(runtime);
-      entry = entry->nextEntryInBucket.get(runtime);
+  // Drop all the entries. Iterators will find their position again after
+  // them, so they continue with the entries inserted afterwards.
+  ++self->epoch_;
+  self->size_ = 0;
+
+  if (self->capacity_ > INITIAL_CAPACITY) {
+    // Shrink back to the initial capacity. This is only an optimization: if
+    // it fails, empty the current storage instead.
+    if (LLVM_LIKELY(
+            resetStorage(self, runtime) != ExecutionStatus::EXCEPTION)) {
+      return;
     }
-    // Clear every element in the hash table.
-    hashTable_.get(runtime)->at(i).setNonPtr(
-        HermesValue::encodeEmptyValue(), &runtime->getHeap());
+    runtime->clearThrownValue();
   }
-  // Resize the hash table to the initial size.
-  ArrayStorage::resizeWithinCapacity(
-      hashTable_.getNonNull(runtime), runtime, INITIAL_CAPACITY);
-  capacity_ = INITIAL_CAPACITY;
-
-  // After clearing, we will still keep the last deleted entry
-  // in case there is an iterator out there
-  // pointing to the middle of the iteration chain. We need it to be
-  // able to merge back eventually.
-  firstIterationEntry_.set(runtime, lastIterationEntry_, &runtime->getHeap());
-  firstIterationEntry_.get(runtime)->prevIterationEntry.setNull(
-      &runtime->getHeap());
-  size_ = 0;
+
+  self->entries_.getNonNull(runtime)->clear(runtime);
+  // Resize the hash table to the initial size, emptying every slot.
+  SegmentedArray *hashTable = self->hashTable_.getNonNull(runtime);
+  SegmentedArray::resizeWithinCapacity(hashTable, runtime, 0);
+  SegmentedArray::resizeWithinCapacity(hashTable, runtime, INITIAL_CAPACITY);
+  self->capacity_ = INITIAL_CAPACITY;
 }
 
 } // namespace vm
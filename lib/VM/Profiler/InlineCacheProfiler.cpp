@@ -68,6 +68,16 @@ bool InlineCacheProfiler::insertICHit(
   return true;
 }
 
+bool InlineCacheProfiler::insertICProtoHit(
+    CodeBlock *codeblock,
+    uint32_t instOffset) {
+  ICMiss &icMiss = getICMissBySourceLocation(codeblock, instOffset);
+  icMiss.incrementProtoHit();
+
+  ++totalProtoHits_;
+  return true;
+}
+
 JSArray *&InlineCacheProfiler::getHiddenClassArray() {
   return cachedHiddenClassesRawPtr_;
 }
@@ -171,12 +181,16 @@ void InlineCacheProfiler::dumpInfoOfSourceLocation(
             << std::get<2>(loc) << "] ";
 
     // output inline caching statistics
+    auto totalAccess = icMiss.missCount + icMiss.hitCount;
     std::stringstream stream;
     stream << std::fixed << std::setprecision(1)
-           << (1. * icMiss.missCount) / (icMiss.missCount + icMiss.hitCount);
+           << (1. * icMiss.missCount) / totalAccess;
     std::string missRatio = stream.str();
-    ostream << "total access: " << icMiss.missCount + icMiss.hitCount
-            << ", miss ratio: " << missRatio << "\n";
+    stream.str("");
+    stream << (1. * icMiss.protoHitCount) / totalAccess;
+    std::string protoHitRatio = stream.str();
+    ostream << "total access: " << totalAccess << ", miss ratio: " << missRatio
+            << ", proto-chain hit ratio: " << protoHitRatio << "\n";
   } else {
     ostream << "[No Loc]\n";
   }
@@ -186,9 +200,12 @@ void InlineCacheProfiler::dumpInfoOfSourceLocation(
 /// detailed information, which include inline caching statistics and
 /// hidden class layouts at the source location.
 /// The source locations are ranked in the descending order of IC misses.
+/// Misses that were served by the prototype chain cache are included in the
+/// miss ratio, and are reported separately as the proto-chain hit ratio.
 ///
 /// An example of output for a specific source location is as follows:
-/// [filename:line:column] total access: 2661, miss ratio: 0.3
+/// [filename:line:column] total access: 2661, miss ratio: 0.3, proto-chain hit
+/// ratio: 0.1
 ///  property: children, inline cache misses: 427
 ///    <type, domNamespace, children, childIndex, context, footer>
 ///    <domNamespace, type, children, childIndex, context, footer>
@@ -16,13 +16,14 @@
 #include <iomanip>
 #include <iostream>
 #include "hermes/Inst/InstDecode.h"
+#include "hermes/VM/JSNativeFunctions.h"
 #endif
 
 namespace hermes {
 namespace vm {
 
 #ifdef HERMESVM_PROFILER_OPCODE
-void Runtime::dumpOpcodeStats(llvm::raw_ostream &os) const {
+void Runtime::dumpOpcodeStats(llvm::raw_ostream &os) {
   std::ostringstream stream;
   // Get all non-zero occurence opcodes.
   std::vector<size_t> idx;
@@ -67,6 +68,120 @@ void Runtime::dumpOpcodeStats(llvm::raw_ostream &os) const {
            << inst::getOpCodeString(static_cast<inst::OpCode>(op)).data()
            << std::setw(22) << t[op] << std::setw(11) << f[op] << "\n";
   }
+
+  // The most frequent pairs of consecutive opcodes, the candidates for
+  // superinstructions.
+  constexpr size_t kMaxOpcodePairs = 40;
+  const auto numOpcodes = static_cast<size_t>(inst::OpCode::_last);
+  std::vector<std::pair<size_t, size_t>> pairs;
+  uint64_t totalDispatches = 0;
+  for (size_t i = 0; i < numOpcodes; ++i) {
+    totalDispatches += f[i];
+    for (size_t j = 0; j < numOpcodes; ++j) {
+      if (opcodePairFrequency[i][j])
+        pairs.emplace_back(i, j);
+    }
+  }
+  std::sort(
+      pairs.begin(),
+      pairs.end(),
+      [this](
+          const std::pair<size_t, size_t> &a,
+          const std::pair<size_t, size_t> &b) {
+        return opcodePairFrequency[a.first][a.second] >
+            opcodePairFrequency[b.first][b.second];
+      });
+  if (pairs.size() > kMaxOpcodePairs)
+    pairs.resize(kMaxOpcodePairs);
+
+  stream << "\nOpcode pairs sorted by frequency:\n"
+         << std::left << std::setfill(' ') << std::setw(25) << "==First=="
+         << std::setw(25) << "==Second==" << std::setw(11) << "==Frequency=="
+         << "\n";
+  for (const auto &pair : pairs) {
+    stream << std::left << std::setfill(' ') << std::setw(25)
+           << inst::getOpCodeString(static_cast<inst::OpCode>(pair.first))
+                  .data()
+           << std::setw(25)
+           << inst::getOpCodeString(static_cast<inst::OpCode>(pair.second))
+                  .data()
+           << std::setw(11) << opcodePairFrequency[pair.first][pair.second]
+           << "\n";
+  }
+  stream << "\nTotal opcodes dispatched: " << totalDispatches << "\n";
+
+  // Time spent in the instructions of each JS function, not counting the
+  // functions it called.
+  struct FunctionEntry {
+    std::string name;
+    uint64_t cycles;
+    uint64_t count;
+  };
+  std::vector<FunctionEntry> functions;
+  uint64_t totalInterpreterCycles = 0;
+  for (auto &runtimeModule : getRuntimeModules()) {
+    for (CodeBlock *codeBlock : runtimeModule.getFunctionMap()) {
+      if (!codeBlock || !codeBlock->opcodeCount)
+        continue;
+      std::string name = codeBlock->getNameString(this);
+      if (name.empty())
+        name = "(anonymous)";
+      if (auto loc = codeBlock->getSourceLocation()) {
+        name += " @ " + std::to_string(loc->line) + ":" +
+            std::to_string(loc->column);
+      } else {
+        name += " #" + std::to_string(codeBlock->getFunctionID());
+      }
+      functions.push_back(
+          {std::move(name), codeBlock->opcodeCycles, codeBlock->opcodeCount});
+      totalInterpreterCycles += codeBlock->opcodeCycles;
+    }
+  }
+  std::sort(
+      functions.begin(),
+      functions.end(),
+      [](const FunctionEntry &a, const FunctionEntry &b) {
+        return a.cycles > b.cycles;
+      });
+
+  stream << "\nJS functions sorted by total time:\n"
+         << std::left << std::setfill(' ') << std::setw(40) << "==Function=="
+         << std::setw(22) << "==Time Spent==" << std::setw(11)
+         << "==Opcodes=="
+         << "\n";
+  for (const auto &entry : functions) {
+    stream << std::left << std::setfill(' ') << std::setw(40) << entry.name
+           << std::setw(22) << entry.cycles << std::setw(11) << entry.count
+           << "\n";
+  }
+
+  // Time spent in native functions, not counting JS they called back into.
+  std::vector<std::pair<void *, NativeCallProfile>> natives{
+      nativeCallProfile.begin(), nativeCallProfile.end()};
+  std::sort(
+      natives.begin(),
+      natives.end(),
+      [](const std::pair<void *, NativeCallProfile> &a,
+         const std::pair<void *, NativeCallProfile> &b) {
+        return a.second.cycles > b.second.cycles;
+      });
+  uint64_t totalNativeCycles = 0;
+  stream << "\nNative functions sorted by total time:\n"
+         << std::left << std::setfill(' ') << std::setw(40) << "==Function=="
+         << std::setw(22) << "==Time Spent==" << std::setw(11) << "==Calls=="
+         << "\n";
+  for (const auto &entry : natives) {
+    // Functions not in NativeFunctions.def (e.g. host functions) are unnamed.
+    const char *name = getFunctionName((NativeFunctionPtr)entry.first);
+    stream << std::left << std::setfill(' ') << std::setw(40)
+           << (*name ? name : "(host function)") << std::setw(22)
+           << entry.second.cycles << std::setw(11) << entry.second.count
+           << "\n";
+    totalNativeCycles += entry.second.cycles;
+  }
+
+  stream << "\nTotal time in interpreter: " << totalInterpreterCycles
+         << "\nTotal time in native functions: " << totalNativeCycles << "\n";
   os << stream.str();
 }
 #endif
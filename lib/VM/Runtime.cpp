@@ -35,6 +35,7 @@
 #include "hermes/VM/Profiler/CodeCoverageProfiler.h"
 #include "hermes/VM/Profiler/SamplingProfiler.h"
 #include "hermes/VM/RuntimeModule-inline.h"
+#include "hermes/VM/SegmentPool.h"
 #include "hermes/VM/StackFrame-inline.h"
 #include "hermes/VM/StackTracesTree.h"
 #include "hermes/VM/StringView.h"
@@ -74,12 +75,36 @@ static const Predefined::Str fixedPropCacheNames[(size_t)PropCacheID::_COUNT] =
 #undef V
 };
 
+/// \return the provider of heap segments requested by \p gcConfig.
+std::unique_ptr<StorageProvider> createStorageProvider(
+    const GCConfig &gcConfig) {
+  if (gcConfig.getHugePageSegments()) {
+    // The shared pool gets its segments from the plain mmap provider, and
+    // gives the pages of pooled segments back to the OS, which would undo
+    // huge pages and prefaulting. Huge pages take precedence.
+    if (gcConfig.getSharedSegmentPoolSize()) {
+      hermesLog(
+          "HermesGC",
+          "SharedSegmentPoolSize is ignored with HugePageSegments.");
+    }
+    return StorageProvider::hugePageProvider(
+        gcConfig.getPrefaultSegments(), gcConfig.getPreferLocalNUMANode());
+  }
+  if (gcConfig.getSharedSegmentPoolSize()) {
+    auto pool = SegmentPool::processPool();
+    pool->raiseMaxPooled(gcConfig.getSharedSegmentPoolSize());
+    return llvm::make_unique<PooledStorageProvider>(std::move(pool));
+  }
+  return StorageProvider::mmapProvider();
+}
+
 } // namespace
 
 /* static */
 std::shared_ptr<Runtime> Runtime::create(const RuntimeConfig &runtimeConfig) {
   return std::shared_ptr<Runtime>{
-      new Runtime(StorageProvider::mmapProvider(), runtimeConfig)};
+      new Runtime(
+          createStorageProvider(runtimeConfig.getGCConfig()), runtimeConfig)};
 }
 
 CallResult<PseudoHandle<>> Runtime::getNamed(
@@ -293,6 +318,9 @@ Runtime::Runtime(
 
   global_ =
       JSObject::create(this, Handle<JSObject>(this, nullptr)).getHermesValue();
+  // Every global variable is a property of the global object, so it quickly
+  // becomes a dictionary. Make sure accesses to it can still be cached.
+  JSObject::makeDictionaryAlwaysCacheable(getGlobal(), this);
 
   JSLibFlags jsLibFlags{};
   jsLibFlags.enableHermesInternal = runtimeConfig.getEnableHermesInternal();
@@ -455,6 +483,8 @@ void Runtime::markRoots(RootAcceptor &acceptor, bool markLongLived) {
     if (markLongLived) {
       for (auto &hv : charStrings_)
         acceptor.accept(hv);
+      for (auto &hv : smallIntStrings_)
+        acceptor.accept(hv);
     }
     acceptor.endRootSection();
   }
@@ -1325,7 +1355,7 @@ void Runtime::initPredefinedStrings() {
   auto symLengths = predefSymbolLengths;
 
   static const uint32_t hashes[] = {
-#define STR(name, string) constexprHashString(string),
+#define STR(name, string) constexprRuntimeHashString(string),
 #include "hermes/VM/PredefinedStrings.def"
   };
 
@@ -1398,6 +1428,27 @@ Handle<StringPrimitive> Runtime::allocateCharacterString(char16_t ch) {
   return makeHandle<StringPrimitive>(strRes);
 }
 
+Handle<StringPrimitive> Runtime::getSmallIntString(uint32_t n) {
+  assert(n < kNumSmallIntStrings && "integer is not small");
+  if (LLVM_UNLIKELY(!smallIntStrings_[n].isString()))
+    return allocateSmallIntString(n);
+  return Handle<StringPrimitive>::vmcast(&smallIntStrings_[n]);
+}
+
+Handle<StringPrimitive> Runtime::allocateSmallIntString(uint32_t n) {
+  PinnedHermesValue &hv = smallIntStrings_[n];
+  // Write base 10 digits in reverse from the end of buf.
+  char buf[10];
+  char *p = buf + sizeof(buf);
+  do {
+    *--p = '0' + (n % 10);
+    n /= 10;
+  } while (n);
+  hv = ignoreAllocationFailure(StringPrimitive::createLongLived(
+      this, ASCIIRef(p, buf + sizeof(buf) - p)));
+  return Handle<StringPrimitive>::vmcast(&hv);
+}
+
 Handle<StringPrimitive> Runtime::getCharacterString(char16_t ch) {
   if (LLVM_LIKELY(ch < 256))
     return Handle<StringPrimitive>::vmcast(&charStrings_[ch]);
@@ -1589,9 +1640,9 @@ uint64_t Runtime::gcStableHashHermesValue(Handle<HermesValue> value) {
     }
     case StrTag: {
       // For strings, we hash the string content.
-      auto strView = StringPrimitive::createStringView(
-          this, Handle<StringPrimitive>::vmcast(value));
-      return llvm::hash_combine_range(strView.begin(), strView.end());
+      auto *str = vmcast<StringPrimitive>(*value);
+      return str->isASCII() ? runtimeHashString(str->getStringRef<char>())
+                            : runtimeHashString(str->getStringRef<char16_t>());
     }
     default:
       assert(!value->isPointer() && "Unhandled pointer type");
@@ -1644,7 +1695,7 @@ void Runtime::dumpCallFrames() {
 }
 
 StackRuntime::StackRuntime(const RuntimeConfig &config)
-    : StackRuntime(StorageProvider::mmapProvider(), config) {}
+    : StackRuntime(createStorageProvider(config.getGCConfig()), config) {}
 
 StackRuntime::StackRuntime(
     std::shared_ptr<StorageProvider> provider,
@@ -1863,6 +1914,13 @@ void Runtime::recordHiddenClass(
       codeBlock, offset, symbolID, objectHiddenClassId, cachedHiddenClassId);
 }
 
+void Runtime::recordPrototypeCacheHit(
+    CodeBlock *codeBlock,
+    const Inst *cacheMissInst) {
+  inlineCacheProfiler_.insertICProtoHit(
+      codeBlock, codeBlock->getOffsetOf(cacheMissInst));
+}
+
 void Runtime::getInlineCacheProfilerInfo(llvm::raw_ostream &ostream) {
   inlineCacheProfiler_.dumpRankedInlineCachingMisses(this, ostream);
 }
@@ -2194,7 +2252,8 @@ StackTracesTreeNode *Runtime::getCurrentStackTracesTreeNode(
     const inst::Inst *ip) {
   assert(stackTracesTree_ && "Runtime not configured to track alloc stacks");
   assert(
-      heap_.getAllocationLocationTracker().isEnabled() &&
+      (heap_.getAllocationLocationTracker().isEnabled() ||
+       heap_.getSamplingAllocationTracker().isEnabled()) &&
       "AllocationLocationTracker not enabled");
   if (!ip) {
     return nullptr;
@@ -2213,10 +2272,39 @@ void Runtime::enableAllocationLocationTracker() {
 }
 
 void Runtime::disableAllocationLocationTracker(bool clearExistingTree) {
-  heap_.getAllocationLocationTracker().disable();
+  auto &tracker = heap_.getAllocationLocationTracker();
+  tracker.disable();
   if (clearExistingTree) {
-    stackTracesTree_.reset();
+    tracker.clear();
+    freeStackTracesTreeIfUnused();
+  }
+}
+
+void Runtime::enableSamplingHeapProfiler(
+    size_t samplingInterval,
+    int64_t seed) {
+  if (!stackTracesTree_) {
+    stackTracesTree_ = make_unique<StackTracesTree>();
   }
+  stackTracesTree_->syncWithRuntimeStack(this);
+  heap_.getSamplingAllocationTracker().enable(samplingInterval, seed);
+}
+
+void Runtime::disableSamplingHeapProfiler(llvm::raw_ostream &os) {
+  heap_.getSamplingAllocationTracker().disable(os, stackTracesTree_.get());
+  freeStackTracesTreeIfUnused();
+}
+
+void Runtime::freeStackTracesTreeIfUnused() {
+  // The allocation location tracker keeps the stack-traces of old allocations
+  // after it is disabled, and they point into the tree.
+  const auto &locationTracker = heap_.getAllocationLocationTracker();
+  if (locationTracker.isEnabled() || locationTracker.hasStackTraces() ||
+      heap_.getSamplingAllocationTracker().isEnabled()) {
+    return;
+  }
+  // Stop maintaining the call stack on every call.
+  stackTracesTree_.reset();
 }
 
 void Runtime::popCallStackImpl() {
@@ -2247,6 +2335,15 @@ void Runtime::enableAllocationLocationTracker() {}
 
 void Runtime::disableAllocationLocationTracker(bool) {}
 
+void Runtime::enableSamplingHeapProfiler(size_t, int64_t) {}
+
+void Runtime::disableSamplingHeapProfiler(llvm::raw_ostream &os) {
+  // Still write out a well-formed, empty profile.
+  heap_.getSamplingAllocationTracker().disable(os, nullptr);
+}
+
+void Runtime::freeStackTracesTreeIfUnused() {}
+
 void Runtime::popCallStackImpl() {}
 
 void Runtime::pushCallStackImpl(const CodeBlock *, const inst::Inst *) {}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifdef HERMESVM_SERIALIZE
+#include "hermes/VM/RuntimeImage.h"
+
+#include "hermes/VM/Serializer.h"
+
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/raw_ostream.h"
+
+namespace hermes {
+namespace vm {
+
+/* static */
+std::shared_ptr<const RuntimeImage> RuntimeImage::capture(
+    Runtime *runtime,
+    ExternalPointersVectorFunction *externalPointers) {
+  llvm::SmallVector<char, 0> data;
+  {
+    llvm::raw_svector_ostream OS(data);
+    Serializer s(OS, runtime, externalPointers);
+    runtime->serialize(s);
+  }
+  // Copy the image into a MemoryBuffer, whose contents are suitably aligned
+  // for the Deserializer to read the bytecode in place.
+  std::shared_ptr<llvm::MemoryBuffer> buffer =
+      llvm::MemoryBuffer::getMemBufferCopy(
+          llvm::StringRef(data.data(), data.size()), "RuntimeImage");
+  return std::shared_ptr<const RuntimeImage>(
+      new RuntimeImage(std::move(buffer), externalPointers));
+}
+
+std::shared_ptr<Runtime> RuntimeImage::instantiate(
+    const RuntimeConfig &runtimeConfig) const {
+  return Runtime::create(runtimeConfig.rebuild()
+                             .withDeserializeFile(buffer_)
+                             .withExternalPointersVectorCallBack(
+                                 externalPointers_)
+                             .build());
+}
+
+/* static */
+std::vector<void *> RuntimeImage::noExternalPointers() {
+  return {};
+}
+
+} // namespace vm
+} // namespace hermes
+#endif // HERMESVM_SERIALIZE
@@ -42,7 +42,7 @@ RuntimeModule::RuntimeModule(
 SymbolID RuntimeModule::createSymbolFromStringIDMayAllocate(
     StringID stringID,
     const StringTableEntry &entry,
-    OptValue<uint32_t> mhash) {
+    llvm::Optional<uint32_t> hash) {
   // Use manual pointer arithmetic to avoid out of bounds errors on empty
   // string accesses.
   auto strStorage = bcProvider_->getStringStorage();
@@ -50,14 +50,14 @@ SymbolID RuntimeModule::createSymbolFromStringIDMayAllocate(
     const char16_t *s =
         (const char16_t *)(strStorage.begin() + entry.getOffset());
     UTF16Ref str{s, entry.getLength()};
-    uint32_t hash = mhash ? *mhash : hashString(str);
-    return mapStringMayAllocate(str, stringID, hash);
+    return hash ? mapStringMayAllocate(str, stringID, *hash)
+                : mapStringMayAllocate(str, stringID);
   } else {
     // ASCII.
     const char *s = (const char *)strStorage.begin() + entry.getOffset();
     ASCIIRef str{s, entry.getLength()};
-    uint32_t hash = mhash ? *mhash : hashString(str);
-    return mapStringMayAllocate(str, stringID, hash);
+    return hash ? mapStringMayAllocate(str, stringID, *hash)
+                : mapStringMayAllocate(str, stringID);
   }
 }
 
@@ -246,13 +246,20 @@ void RuntimeModule::importStringIDMapMayAllocate() {
     bcProvider_->willNeedStringTable();
   }
 
-  // Get the array of pre-computed hashes from identifiers in the bytecode
-  // to their runtime representation as SymbolIDs.
+  // Map the identifiers in the bytecode to their runtime representation as
+  // SymbolIDs. The bytecode also records a hash of every identifier, but that
+  // is the bytecode-stable hashString(), while the identifier table uses
+  // runtimeHashString(). The provider computes the runtime hashes once, so
+  // only the first runtime to load it pays for hashing the identifiers.
   auto kinds = bcProvider_->getStringKinds();
   auto hashes = bcProvider_->getIdentifierHashes();
   assert(
       hashes.size() <= strTableSize &&
       "Should not have more strings than identifiers");
+  auto runtimeHashes = bcProvider_->getRuntimeIdentifierHashes();
+  assert(
+      runtimeHashes.size() == hashes.size() &&
+      "Should have a runtime hash for every identifier");
 
   // Preallocate enough space to store all identifiers to prevent
   // unnecessary allocations. NOTE: If this module is not the first module,
@@ -271,7 +278,9 @@ void RuntimeModule::importStringIDMapMayAllocate() {
         case StringKind::Identifier:
           for (uint32_t i = 0; i < entry.count(); ++i, ++strID, ++hashID) {
             createSymbolFromStringIDMayAllocate(
-                strID, bcProvider_->getStringTableEntry(strID), hashes[hashID]);
+                strID,
+                bcProvider_->getStringTableEntry(strID),
+                runtimeHashes[hashID]);
           }
           break;
       }
@@ -297,7 +306,7 @@ void RuntimeModule::importStringIDMapMayAllocate() {
     // we need to add it manually and it will have index 0.
     ASCIIRef s;
     stringIDMap_.push_back({});
-    mapStringMayAllocate(s, 0, hashString(s));
+    mapStringMayAllocate(s, 0);
   }
 
   // Done with hashes, so advise them out if possible.
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/VM/SegmentPool.h"
+
+#include "hermes/Support/OSCompat.h"
+#include "hermes/VM/AlignedStorage.h"
+
+#include <algorithm>
+
+namespace hermes {
+namespace vm {
+
+SegmentPool::SegmentPool(
+    std::unique_ptr<StorageProvider> upstream,
+    size_t maxPooled)
+    : upstream_(std::move(upstream)), maxPooled_(maxPooled) {}
+
+SegmentPool::~SegmentPool() {
+  for (void *storage : pooled_) {
+    upstream_->deleteStorage(storage);
+  }
+}
+
+/* static */
+std::shared_ptr<SegmentPool> SegmentPool::processPool() {
+  // Leaked on purpose: runtimes may still be destroyed during static
+  // destruction, and keep the pool alive through their providers anyway.
+  static auto *pool = new std::shared_ptr<SegmentPool>(
+      std::make_shared<SegmentPool>(StorageProvider::mmapProvider(), 0));
+  return *pool;
+}
+
+llvm::ErrorOr<void *> SegmentPool::acquire(const char *name) {
+  std::lock_guard<std::mutex> lk{mutex_};
+  if (pooled_.empty()) {
+    return upstream_->newStorage(name);
+  }
+  void *storage = pooled_.back();
+  pooled_.pop_back();
+  ++numReused_;
+  oscompat::vm_name(storage, AlignedStorage::size(), name);
+  return storage;
+}
+
+void SegmentPool::release(void *storage) {
+  std::lock_guard<std::mutex> lk{mutex_};
+  if (pooled_.size() >= maxPooled_) {
+    upstream_->deleteStorage(storage);
+    return;
+  }
+  // Keep the address range, but give the pages back to the OS.
+  oscompat::vm_unused(storage, AlignedStorage::size());
+  pooled_.push_back(storage);
+}
+
+void SegmentPool::raiseMaxPooled(size_t maxPooled) {
+  std::lock_guard<std::mutex> lk{mutex_};
+  maxPooled_ = std::max(maxPooled_, maxPooled);
+}
+
+size_t SegmentPool::numPooled() const {
+  std::lock_guard<std::mutex> lk{mutex_};
+  return pooled_.size();
+}
+
+size_t SegmentPool::numReused() const {
+  std::lock_guard<std::mutex> lk{mutex_};
+  return numReused_;
+}
+
+llvm::ErrorOr<void *> PooledStorageProvider::newStorageImpl(const char *name) {
+  return pool_->acquire(name);
+}
+
+void PooledStorageProvider::deleteStorageImpl(void *storage) {
+  if (!storage) {
+    return;
+  }
+  pool_->release(storage);
+}
+
+} // namespace vm
+} // namespace hermes
@@ -13,9 +13,11 @@
 #include "hermes/VM/AlignedStorage.h"
 
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/MathExtras.h"
 
+#include <algorithm>
 #include <cassert>
 #include <limits>
 #include <stack>
@@ -40,6 +42,27 @@ class VMAllocateStorageProvider final : public StorageProvider {
   void deleteStorageImpl(void *storage) override;
 };
 
+class HugePageStorageProvider final : public StorageProvider {
+ public:
+  HugePageStorageProvider(bool prefault, bool preferLocalNUMANode)
+      : prefault_(prefault),
+        numaNode_(preferLocalNUMANode ? oscompat::numa_node() : -1) {}
+
+  llvm::ErrorOr<void *> newStorageImpl(const char *name) override;
+  void deleteStorageImpl(void *storage) override;
+  llvm::Optional<size_t> hugePageBytes() const override;
+
+ private:
+  /// Whether to fault in new storages before returning them.
+  const bool prefault_;
+  /// The NUMA node to prefer for new storages, or -1 for no preference.
+  const int numaNode_;
+  /// Set if the OS refused to use huge pages for a storage.
+  bool hugePagesRefused_{false};
+  /// The storages which have been allocated and not deleted yet.
+  llvm::DenseSet<void *> liveStorages_;
+};
+
 class MallocStorageProvider final : public StorageProvider {
  public:
   llvm::ErrorOr<void *> newStorageImpl(const char *name) override;
@@ -77,6 +100,66 @@ void VMAllocateStorageProvider::deleteStorageImpl(void *storage) {
   oscompat::vm_free_aligned(storage, AlignedStorage::size());
 }
 
+llvm::ErrorOr<void *> HugePageStorageProvider::newStorageImpl(
+    const char *name) {
+  assert(AlignedStorage::size() % oscompat::page_size() == 0);
+  auto result = oscompat::vm_allocate_aligned(
+      AlignedStorage::size(), AlignedStorage::size());
+  if (!result) {
+    return result;
+  }
+  char *mem = static_cast<char *>(*result);
+  assert(isAligned(mem));
+  oscompat::vm_name(mem, AlignedStorage::size(), name);
+
+  // The storage is aligned to its size, which is a multiple of the huge page
+  // size, so it can be backed entirely by huge pages. Both the advice and the
+  // NUMA policy only affect pages faulted in after they are set.
+  if (!oscompat::vm_madvise(
+          mem, AlignedStorage::size(), oscompat::MAdvice::HugePage)) {
+    hugePagesRefused_ = true;
+  }
+  if (numaNode_ >= 0) {
+    oscompat::vm_prefer_numa_node(mem, AlignedStorage::size(), numaNode_);
+  }
+  if (prefault_) {
+    // Writing to one byte of each page faults in the page, or the whole huge
+    // page around it.
+    const size_t pageSize = oscompat::page_size();
+    for (size_t offset = 0; offset < AlignedStorage::size();
+         offset += pageSize) {
+      *static_cast<volatile char *>(mem + offset) = 0;
+    }
+  }
+  liveStorages_.insert(mem);
+  return mem;
+}
+
+void HugePageStorageProvider::deleteStorageImpl(void *storage) {
+  if (!storage) {
+    return;
+  }
+  liveStorages_.erase(storage);
+  oscompat::vm_free_aligned(storage, AlignedStorage::size());
+}
+
+llvm::Optional<size_t> HugePageStorageProvider::hugePageBytes() const {
+  if (hugePagesRefused_) {
+    return llvm::None;
+  }
+  std::vector<std::pair<const void *, size_t>> regions;
+  regions.reserve(liveStorages_.size());
+  for (void *storage : liveStorages_) {
+    regions.emplace_back(storage, AlignedStorage::size());
+  }
+  std::sort(regions.begin(), regions.end());
+  int64_t bytes = oscompat::huge_pages_in_ram(regions);
+  if (bytes < 0) {
+    return llvm::None;
+  }
+  return static_cast<size_t>(bytes);
+}
+
 llvm::ErrorOr<void *> MallocStorageProvider::newStorageImpl(const char *name) {
   // name is unused, can't name malloc memory.
   (void)name;
@@ -107,6 +190,14 @@ std::unique_ptr<StorageProvider> StorageProvider::mallocProvider() {
   return std::unique_ptr<StorageProvider>(new MallocStorageProvider);
 }
 
+/* static */
+std::unique_ptr<StorageProvider> StorageProvider::hugePageProvider(
+    bool prefault,
+    bool preferLocalNUMANode) {
+  return std::unique_ptr<StorageProvider>(
+      new HugePageStorageProvider(prefault, preferLocalNUMANode));
+}
+
 llvm::ErrorOr<void *> StorageProvider::newStorage(const char *name) {
   auto res = newStorageImpl(name);
 
@@ -404,6 +404,42 @@ CallResult<HermesValue> StringPrimitive::slice(
   assert(
       start + length <= str->getStringLength() && "Invalid length for slice");
 
+  // Slicing the whole string is a no-op, since strings are immutable.
+  if (start == 0 && length == str->getStringLength()) {
+    return str.getHermesValue();
+  }
+
+  if (length >= SLICED_STRING_MIN_SIZE) {
+    // Reference the characters of the parent of a slice directly, so accessing
+    // a slice is never more than one indirection.
+    StringPrimitive *parent = str.get();
+    uint32_t offset = start;
+    if (isSlicedStringPrimitive(parent)) {
+      if (parent->isASCII()) {
+        auto *sliced = vmcast<SlicedASCIIStringPrimitive>(parent);
+        offset += sliced->getOffset();
+        parent = sliced->getParent();
+      } else {
+        auto *sliced = vmcast<SlicedUTF16StringPrimitive>(parent);
+        offset += sliced->getOffset();
+        parent = sliced->getParent();
+      }
+    }
+    uint32_t parentLength = parent->getStringLength();
+    if (parentLength < EXTERNAL_STRING_THRESHOLD ||
+        parentLength / length <= SLICED_STRING_MAX_PARENT_RATIO) {
+      auto parentHnd = runtime->makeHandle(parent);
+      if (parentHnd->isASCII()) {
+        return SlicedASCIIStringPrimitive::create(
+                   runtime, parentHnd, offset, length)
+            .getHermesValue();
+      }
+      return SlicedUTF16StringPrimitive::create(
+                 runtime, parentHnd, offset, length)
+          .getHermesValue();
+    }
+  }
+
   SafeUInt32 safeLen(length);
 
   auto builder =
@@ -606,6 +642,14 @@ void ExternalStringPrimitive<T>::_finalizeImpl(GCCell *cell, GC *gc) {
   // tracked.
   gc->getIDTracker().untrackNative(self->contents_.data());
   gc->debitExternalMemory(self, self->calcExternalMemorySize());
+  if (gc->getBackgroundFinalizer()) {
+    // Move the contents out, so that they are freed after the collection.
+    gc->releaseNative(
+        [](void *contents) {
+          delete static_cast<CopyableStdString *>(contents);
+        },
+        new CopyableStdString(std::move(self->contents_)));
+  }
   self->~ExternalStringPrimitive<T>();
 }
 
@@ -856,5 +900,92 @@ void BufferedStringPrimitive<T>::_snapshotAddNodesImpl(
 
 template class BufferedStringPrimitive<char16_t>;
 template class BufferedStringPrimitive<char>;
+
+//===----------------------------------------------------------------------===//
+// SlicedStringPrimitive<T>
+
+void SlicedASCIIStringPrimitiveBuildMeta(
+    const GCCell *cell,
+    Metadata::Builder &mb) {
+  const auto *self = static_cast<const SlicedASCIIStringPrimitive *>(cell);
+  mb.addField("parent", &self->parentHV_);
+}
+void SlicedUTF16StringPrimitiveBuildMeta(
+    const GCCell *cell,
+    Metadata::Builder &mb) {
+  const auto *self = static_cast<const SlicedUTF16StringPrimitive *>(cell);
+  mb.addField("parent", &self->parentHV_);
+}
+
+template <typename T>
+PseudoHandle<StringPrimitive> SlicedStringPrimitive<T>::create(
+    Runtime *runtime,
+    Handle<StringPrimitive> parent,
+    uint32_t offset,
+    uint32_t length) {
+  void *mem = runtime->alloc</*fixedSize*/ true, HasFinalizer::No>(
+      sizeof(SlicedStringPrimitive<T>));
+  return createPseudoHandle<StringPrimitive>(new (mem) SlicedStringPrimitive<T>(
+      runtime, parent.get(), offset, length));
+}
+
+#ifdef HERMESVM_SERIALIZE
+template <typename T>
+SlicedStringPrimitive<T>::SlicedStringPrimitive(
+    Deserializer &d,
+    uint32_t offset,
+    uint32_t length)
+    : StringPrimitive(
+          d.getRuntime(),
+          &vt,
+          sizeof(SlicedStringPrimitive<T>),
+          length),
+      offset_(offset) {}
+
+template <typename T>
+void serializeSlicedStringImpl(Serializer &s, const GCCell *cell) {
+  const auto *self = vmcast<const SlicedStringPrimitive<T>>(cell);
+  s.writeInt<uint32_t>(self->getStringLength());
+  s.writeInt<uint32_t>(self->offset_);
+  s.writeHermesValue(self->parentHV_);
+  s.endObject(cell);
+}
+
+template <typename T>
+void deserializeSlicedStringImpl(Deserializer &d) {
+  uint32_t length = d.readInt<uint32_t>();
+  uint32_t offset = d.readInt<uint32_t>();
+  void *mem = d.getRuntime()->alloc</*fixedSize*/ true, HasFinalizer::No>(
+      sizeof(SlicedStringPrimitive<T>));
+  auto *cell = new (mem) SlicedStringPrimitive<T>(d, offset, length);
+  d.readHermesValue(&cell->parentHV_);
+  d.endObject(cell);
+}
+
+void SlicedASCIIStringPrimitiveSerialize(Serializer &s, const GCCell *cell) {
+  serializeSlicedStringImpl<char>(s, cell);
+}
+
+void SlicedUTF16StringPrimitiveSerialize(Serializer &s, const GCCell *cell) {
+  serializeSlicedStringImpl<char16_t>(s, cell);
+}
+
+void SlicedASCIIStringPrimitiveDeserialize(Deserializer &d, CellKind kind) {
+  assert(
+      kind == CellKind::SlicedASCIIStringPrimitiveKind &&
+      "Expected SlicedASCIIStringPrimitive");
+  deserializeSlicedStringImpl<char>(d);
+}
+
+void SlicedUTF16StringPrimitiveDeserialize(Deserializer &d, CellKind kind) {
+  assert(
+      kind == CellKind::SlicedUTF16StringPrimitiveKind &&
+      "Expected SlicedUTF16StringPrimitive");
+  deserializeSlicedStringImpl<char16_t>(d);
+}
+#endif
+
+template class SlicedStringPrimitive<char16_t>;
+template class SlicedStringPrimitive<char>;
 } // namespace vm
 } // namespace hermes
@@ -34,7 +34,7 @@ uint32_t IdentifierHashTable::lookupString(
   assert(size_ < cap && "The hash table can never be full");
 
 #ifdef HERMES_SLOW_DEBUG
-  assert(hash == hashString(str) && "invalid hash");
+  assert(hash == runtimeHashString(str) && "invalid hash");
 #endif
   uint32_t idx = hash & (cap - 1);
   uint32_t base = 1;
@@ -290,15 +290,21 @@ void AlignedHeapSegment::deleteDeadObjectIDs(GC *gc) {
   GCBase::IDTracker &idTracker = gc->getIDTracker();
   GCBase::AllocationLocationTracker &allocationLocationTracker =
       gc->getAllocationLocationTracker();
-  if (idTracker.isTrackingIDs() || allocationLocationTracker.isEnabled()) {
+  GCBase::SamplingAllocationLocationTracker &samplingAllocationTracker =
+      gc->getSamplingAllocationTracker();
+  if (idTracker.isTrackingIDs() || allocationLocationTracker.isEnabled() ||
+      samplingAllocationTracker.isEnabled()) {
     MarkBitArrayNC &markBits = markBitArray();
     // Separate out the delete tracking into a different loop in order to keep
     // the normal case fast.
-    forAllObjs([&markBits, &idTracker, &allocationLocationTracker](
-                   const GCCell *cell) {
+    forAllObjs([&markBits,
+                &idTracker,
+                &allocationLocationTracker,
+                &samplingAllocationTracker](const GCCell *cell) {
       if (!markBits.at(markBits.addressToIndex(cell))) {
         idTracker.untrackObject(cell);
         allocationLocationTracker.freeAlloc(cell);
+        samplingAllocationTracker.freeAlloc(cell);
       }
     });
   }
@@ -310,7 +316,10 @@ void AlignedHeapSegment::updateObjectIDs(
   GCBase::IDTracker &idTracker = gc->getIDTracker();
   GCBase::AllocationLocationTracker &allocationLocationTracker =
       gc->getAllocationLocationTracker();
-  if (!idTracker.isTrackingIDs() && !allocationLocationTracker.isEnabled()) {
+  GCBase::SamplingAllocationLocationTracker &samplingAllocationTracker =
+      gc->getSamplingAllocationTracker();
+  if (!idTracker.isTrackingIDs() && !allocationLocationTracker.isEnabled() &&
+      !samplingAllocationTracker.isEnabled()) {
     // If ID tracking isn't on, there's nothing to do here.
     return;
   }
@@ -324,6 +333,7 @@ void AlignedHeapSegment::updateObjectIDs(
       auto *cell = reinterpret_cast<GCCell *>(ptr);
       idTracker.moveObject(cell, cell->getForwardingPointer());
       allocationLocationTracker.moveAlloc(cell, cell->getForwardingPointer());
+      samplingAllocationTracker.moveAlloc(cell, cell->getForwardingPointer());
       const VTable *vtp = vTablesCopy.next();
       auto cellSize = cell->getAllocatedSize(vtp);
       ptr += cellSize;
@@ -42,6 +42,9 @@ void CompleteMarkState::markTransitive(void *ptr) {
   // this to reach transitive closure will be reset, and the
   // transitive closure process restarted. See, e.g., GenGC::completeMarking.
   markBits->mark(ind);
+  if (LLVM_UNLIKELY(ephemerons_)) {
+    ephemerons_->cellMarked(reinterpret_cast<GCCell *>(ptr));
+  }
 
   // By only pushing ptrs that point back down the heap and leaving
   // others to be fully marked later, potential size of markStack_
@@ -652,10 +652,13 @@ void GenGC::completeMarking() {
 void GenGC::completeWeakMapMarking() {
   CompleteMarkState::FullMSCMarkTransitiveAcceptor acceptor(*this, &markState_);
 
+  auto weakMapMarkStart = steady_clock::now();
   // Set the currentParPointer to a maximal value, so all pointers scanned
   // will be pushed on the mark stack.
   markState_.currentParPointer =
       reinterpret_cast<GCCell *>(static_cast<intptr_t>(-1));
+  WeakMapEphemeronTable ephemerons;
+  markState_.ephemerons_ = &ephemerons;
 
   // GCBase::completeWeakMapMarking returns the total size of the reachable
   // WeakMaps, but GenGC computes allocatedBytes in a different way, so we don't
@@ -664,6 +667,7 @@ void GenGC::completeWeakMapMarking() {
       this,
       acceptor,
       markState_.reachableWeakMaps_,
+      ephemerons,
       /*objIsMarked*/ AlignedHeapSegment::getCellMarkBit,
       /*checkValIsMarked*/
       [this, &acceptor](GCCell *valCell, GCHermesValue &valRef) {
@@ -682,8 +686,11 @@ void GenGC::completeWeakMapMarking() {
       /*checkMarkStackOverflow*/
       [this]() { return markState_.markStackOverflow_; });
 
+  markState_.ephemerons_ = nullptr;
   markState_.currentParPointer = nullptr;
   markState_.reachableWeakMaps_.clear();
+  weakMapMarkSecs_ +=
+      GCBase::clockDiffSeconds(weakMapMarkStart, steady_clock::now());
 }
 
 void GenGC::finalizeUnreachableObjects() {
@@ -1839,6 +1846,7 @@ void GenGC::printStats(llvm::raw_ostream &os, bool trailingComma) {
      << "\t\t\t\"fullFinalSize\": "
      << formatSize(fullCollectionCumStats_.finalHeapSize).bytes << ",\n";
 
+  printHugePageStats(os, *storageProvider_);
   printFullCollectionStats(os, /*trailingComma*/ false);
   os << "\t\t}\n"
      << "\t},\n";
@@ -1859,6 +1867,7 @@ void GenGC::printFullCollectionStats(llvm::raw_ostream &os, bool trailingComma)
 
   os << "\t\t\t\"fullMarkRootsTime\": " << markRootsSecs_ << ",\n"
      << "\t\t\t\"fullMarkTransitiveTime\": " << markTransitiveSecs_ << ",\n"
+     << "\t\t\t\"fullWeakMapMarkTime\": " << weakMapMarkSecs_ << ",\n"
      << "\t\t\t\"fullSweepTime\": " << sweepSecs_ << ",\n"
      << "\t\t\t\"fullUpdateRefsTime\": " << updateReferencesSecs_ << ",\n"
      << "\t\t\t\"fullCompactTime\": " << compactSecs_ << ",\n"
@@ -2448,7 +2457,8 @@ void GenGC::sizeDiagnosticCensus() {
 
     if (cell->getKind() == CellKind::DynamicASCIIStringPrimitiveKind ||
         cell->getKind() == CellKind::DynamicUniquedASCIIStringPrimitiveKind ||
-        cell->getKind() == CellKind::ExternalASCIIStringPrimitiveKind) {
+        cell->getKind() == CellKind::ExternalASCIIStringPrimitiveKind ||
+        cell->getKind() == CellKind::SlicedASCIIStringPrimitiveKind) {
       acceptor.diagnostic.asciiStr.count++;
       auto *strprim = vmcast<StringPrimitive>(cell);
       if (strprim->getStringLength() < 8) {
@@ -2458,7 +2468,8 @@ void GenGC::sizeDiagnosticCensus() {
     } else if (
         cell->getKind() == CellKind::DynamicUTF16StringPrimitiveKind ||
         cell->getKind() == CellKind::DynamicUniquedUTF16StringPrimitiveKind ||
-        cell->getKind() == CellKind::ExternalUTF16StringPrimitiveKind) {
+        cell->getKind() == CellKind::ExternalUTF16StringPrimitiveKind ||
+        cell->getKind() == CellKind::SlicedUTF16StringPrimitiveKind) {
       acceptor.diagnostic.utf16Str.count++;
       auto *strprim = vmcast<StringPrimitive>(cell);
       if (strprim->getStringLength() < 8) {
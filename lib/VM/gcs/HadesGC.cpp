@@ -485,6 +485,12 @@ class HadesGC::MarkAcceptor final : public SlotAcceptorDefault,
     return reachableWeakMaps_;
   }
 
+  /// Report every cell marked from now on to \p ephemerons, or stop if it is
+  /// null.
+  void setEphemerons(WeakMapEphemeronTable *ephemerons) {
+    ephemerons_ = ephemerons;
+  }
+
   const std::vector<bool> &markedSymbols() {
     return markedSymbols_;
   }
@@ -499,6 +505,10 @@ class HadesGC::MarkAcceptor final : public SlotAcceptorDefault,
   /// The WeakMap objects that have been discovered to be reachable.
   std::vector<JSWeakMap *> reachableWeakMaps_;
 
+  /// While WeakMap marking is in progress, the table which is told about
+  /// every newly marked cell.  Null otherwise.
+  WeakMapEphemeronTable *ephemerons_{nullptr};
+
   /// markedSymbols_ represents which symbols have been proven live so far in
   /// a collection. True means that it is live, false means that it could
   /// possibly be garbage. At the end of the collection, it is guaranteed that
@@ -509,6 +519,9 @@ class HadesGC::MarkAcceptor final : public SlotAcceptorDefault,
 
   void push(GCCell *cell) {
     HeapSegment::setCellMarkBit(cell);
+    if (LLVM_UNLIKELY(ephemerons_)) {
+      ephemerons_->cellMarked(cell);
+    }
     // Add it to the worklist to recurse on that cell.
     if (cell->getKind() == CellKind::WeakMapKind) {
       reachableWeakMaps_.push_back(vmcast<JSWeakMap>(cell));
@@ -625,7 +638,9 @@ void HadesGC::printStats(llvm::raw_ostream &os, bool trailingComma) {
   GCBase::printStats(os, true);
   os << "\t\"specific\": {\n"
      << "\t\t\"collector\": \"hades\",\n"
-     << "\t\t\"stats\": {\n"
+     << "\t\t\"stats\": {\n";
+  printHugePageStats(os, *provider_);
+  os << "\t\t\t\"weakMapMarkTime\": " << weakMapMarkSecs_ << "\n"
      << "\t\t}\n"
      << "\t},\n";
   gcCallbacks_->printRuntimeGCStats(os);
@@ -1103,10 +1118,14 @@ void HadesGC::updateWeakReferencesForOldGen() {
 }
 
 void HadesGC::completeWeakMapMarking(MarkAcceptor &acceptor) {
+  auto weakMapMarkStart = std::chrono::steady_clock::now();
+  WeakMapEphemeronTable ephemerons;
+  acceptor.setEphemerons(&ephemerons);
   gcheapsize_t weakMapAllocBytes = GCBase::completeWeakMapMarking(
       this,
       acceptor,
       acceptor.reachableWeakMaps(),
+      ephemerons,
       /*objIsMarked*/
       HeapSegment::getCellMarkBit,
       /*markFromVal*/
@@ -1123,8 +1142,11 @@ void HadesGC::completeWeakMapMarking(MarkAcceptor &acceptor) {
       /*checkMarkStackOverflow (HadesGC does not have mark stack overflow)*/
       []() { return false; });
 
+  acceptor.setEphemerons(nullptr);
   acceptor.reachableWeakMaps().clear();
   (void)weakMapAllocBytes;
+  weakMapMarkSecs_ += GCBase::clockDiffSeconds(
+      weakMapMarkStart, std::chrono::steady_clock::now());
 }
 
 void HadesGC::resetWeakReferences() {
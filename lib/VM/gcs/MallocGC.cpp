@@ -34,6 +34,10 @@ struct MallocGC::MarkingAcceptor final : public SlotAcceptorDefault,
   /// The WeakMap objects that have been discovered to be reachable.
   std::vector<JSWeakMap *> reachableWeakMaps_;
 
+  /// While WeakMap marking is in progress, the table which is told about
+  /// every newly marked cell.  Null otherwise.
+  WeakMapEphemeronTable *ephemerons_{nullptr};
+
   /// markedSymbols_ represents which symbols have been proven live so far in
   /// a collection. True means that it is live, false means that it could
   /// possibly be garbage. At the end of the collection, it is guaranteed that
@@ -85,6 +89,10 @@ struct MallocGC::MarkingAcceptor final : public SlotAcceptorDefault,
       // Make sure to put an element on the worklist that is at the updated
       // location. Don't update the stale address that is about to be free'd.
       header->markWithForwardingPointer(newLocation);
+      // WeakMap keys still refer to the old location during marking.
+      if (LLVM_UNLIKELY(ephemerons_)) {
+        ephemerons_->cellMarked(cell);
+      }
       auto *newCell = newLocation->data();
       if (newCell->getKind() == CellKind::WeakMapKind) {
         reachableWeakMaps_.push_back(vmcast<JSWeakMap>(newCell));
@@ -95,12 +103,18 @@ struct MallocGC::MarkingAcceptor final : public SlotAcceptorDefault,
       if (gc.idTracker_.isTrackingIDs()) {
         gc.idTracker_.moveObject(cell, newLocation->data());
       }
+      if (gc.samplingAllocationTracker_.isEnabled()) {
+        gc.samplingAllocationTracker_.moveAlloc(cell, newLocation->data());
+      }
       cell = newLocation->data();
     }
 #else
     if (!header->isMarked()) {
       // Only add to the worklist if it hasn't been marked yet.
       header->mark();
+      if (LLVM_UNLIKELY(ephemerons_)) {
+        ephemerons_->cellMarked(cell);
+      }
       // Trim the cell. This is fine to do with malloc'ed memory because the
       // original size is retained by malloc.
       if (cell->getVT()->canBeTrimmed()) {
@@ -322,6 +336,9 @@ void MallocGC::collect() {
       if (allocationLocationTracker_.isEnabled()) {
         allocationLocationTracker_.freeAlloc(cell);
       }
+      if (samplingAllocationTracker_.isEnabled()) {
+        samplingAllocationTracker_.freeAlloc(cell);
+      }
 #ifndef NDEBUG
       // Before free'ing, fill with a dead value for debugging
       std::fill_n(reinterpret_cast<char *>(cell), freedSize, kInvalidHeapValue);
@@ -393,10 +410,13 @@ void MallocGC::drainMarkStack(MarkingAcceptor &acceptor) {
 }
 
 void MallocGC::completeWeakMapMarking(MarkingAcceptor &acceptor) {
+  WeakMapEphemeronTable ephemerons;
+  acceptor.ephemerons_ = &ephemerons;
   gcheapsize_t weakMapAllocBytes = GCBase::completeWeakMapMarking(
       this,
       acceptor,
       acceptor.reachableWeakMaps_,
+      ephemerons,
       /*objIsMarked*/
       [](GCCell *cell) { return CellHeader::from(cell)->isMarked(); },
       /*markFromVal*/
@@ -420,6 +440,7 @@ void MallocGC::completeWeakMapMarking(MarkingAcceptor &acceptor) {
       /*checkMarkStackOverflow (MallocGC does not have mark stack overflow)*/
       []() { return false; });
 
+  acceptor.ephemerons_ = nullptr;
   acceptor.reachableWeakMaps_.clear();
   // drainMarkStack will have added the size of every object popped
   // from the mark stack.  WeakMaps are never pushed on that stack,
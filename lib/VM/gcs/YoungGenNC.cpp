@@ -382,7 +382,8 @@ void YoungGen::collect() {
     updateIDTracker();
   }
 
-  if (gc_->getAllocationLocationTracker().isEnabled()) {
+  if (gc_->getAllocationLocationTracker().isEnabled() ||
+      gc_->getSamplingAllocationTracker().isEnabled()) {
     PerfSection updateAllocationLocationTrackerSystraceRegion(
         "updateAllocationLocationTracker");
     updateAllocationLocationTracker();
@@ -599,6 +600,7 @@ void YoungGen::updateTrackers() {
       }
       if (allocationLocationTracker) {
         gc_->getAllocationLocationTracker().moveAlloc(cell, fptr);
+        gc_->getSamplingAllocationTracker().moveAlloc(cell, fptr);
       }
       ptr += reinterpret_cast<GCCell *>(fptr)->getAllocatedSize();
     } else {
@@ -608,6 +610,7 @@ void YoungGen::updateTrackers() {
       }
       if (allocationLocationTracker) {
         gc_->getAllocationLocationTracker().freeAlloc(cell);
+        gc_->getSamplingAllocationTracker().freeAlloc(cell);
       }
     }
   }
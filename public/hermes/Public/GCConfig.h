@@ -140,6 +140,29 @@ enum class GCEventKind {
   /* Whether to track allocation traces starting in the Runtime ctor. */  \
   F(constexpr, bool, AllocationLocationTrackerFromStart, false)           \
                                                                           \
+  /* Whether finalizers may release native resources (ArrayBuffer */      \
+  /* data, external strings, host objects and host functions) on a */     \
+  /* background thread after the collection, instead of during it. */     \
+  F(constexpr, bool, BackgroundFinalization, false)                       \
+                                                                          \
+  /* Whether to ask the OS to back heap segments with huge pages, to */   \
+  /* reduce TLB misses while marking and allocating in large heaps. */    \
+  F(constexpr, bool, HugePageSegments, false)                             \
+                                                                          \
+  /* With HugePageSegments, whether to fault in every page of a new */    \
+  /* segment when it is allocated, instead of on first use. */            \
+  F(constexpr, bool, PrefaultSegments, false)                             \
+                                                                          \
+  /* With HugePageSegments, whether to prefer allocating segments on */   \
+  /* the NUMA node of the thread which creates the runtime. */            \
+  F(constexpr, bool, PreferLocalNUMANode, false)                          \
+                                                                          \
+  /* If non-zero, get heap segments from a pool shared by all the */      \
+  /* runtimes of the process, which keeps up to this many segments */     \
+  /* released by one runtime for the next one that needs them. */         \
+  /* Ignored with HugePageSegments. */                                    \
+  F(constexpr, unsigned, SharedSegmentPoolSize, 0)                        \
+                                                                          \
   /* Callout for an analytics event. */                                   \
   F(HERMES_NON_CONSTEXPR,                                                 \
     std::function<void(const GCAnalyticsEvent &)>,                        \
@@ -46,7 +46,7 @@ function *loop(x) {
 // CHECK-NEXT:     ToNumber          r10, r9
 // CHECK-NEXT:     AddN              r11, r10, r4
 // CHECK-NEXT:     StoreToEnvironment r0, 0, r11
-// CHECK-NEXT:     GetByVal          r12, r7, r10
+// CHECK-NEXT:     GetByValN         r12, r7, r10
 // CHECK-NEXT:     SaveGenerator     L3
 // CHECK-NEXT:     Ret               r12
 // CHECK-NEXT: L3:
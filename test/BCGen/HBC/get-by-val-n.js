@@ -0,0 +1,25 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -target=HBC -dump-bytecode -O %s | %FileCheck --match-full-lines %s
+"use strict";
+
+function copy(dst, src, n) {
+  for (var i = 0; i < n; ++i)
+    dst[i] = src[i];
+}
+
+function lookup(obj, key) {
+  return obj[key];
+}
+
+// CHECK-LABEL: Function<copy>(4 params, {{[0-9]+}} registers, 0 symbols):
+// CHECK:         GetByValN         r{{[0-9]+}}, r{{[0-9]+}}, r{{[0-9]+}}
+// CHECK-NEXT:    PutByValN         r{{[0-9]+}}, r{{[0-9]+}}, r{{[0-9]+}}
+
+// CHECK-LABEL: Function<lookup>(3 params, {{[0-9]+}} registers, 0 symbols):
+// CHECK:         GetByVal          r{{[0-9]+}}, r{{[0-9]+}}, r{{[0-9]+}}
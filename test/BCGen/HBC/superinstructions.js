@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -target=HBC -dump-bytecode -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -target=HBC -dump-bytecode -O -fno-superinstructions %s | %FileCheck --match-full-lines --check-prefix=NOFUSE %s
+// RUN: %hermes -target=HBC -dump-bytecode -O -g %s | %FileCheck --match-full-lines --check-prefix=NOFUSE %s
+"use strict";
+
+function countUp(n) {
+  var sum = 0;
+  for (var i = 0; i < n; ++i)
+    sum += i;
+  return sum;
+}
+
+function countDown(n) {
+  var fact = n;
+  while (--n > 1)
+    fact *= n;
+  return fact;
+}
+
+function countDownTo(n, limit) {
+  var count = 0;
+  while ((n -= 2) >= limit)
+    ++count;
+  return count;
+}
+
+function countUpTo(n) {
+  var product = 1;
+  for (var i = 1; i <= n; ++i)
+    product *= i;
+  return product;
+}
+
+// The update of the loop counter is fused with the branch of the back edge,
+// even when register copies were scheduled between them.
+
+// CHECK-LABEL:Function<countUp>(2 params, 6 registers, 0 symbols):
+// CHECK:L2:
+// CHECK-NEXT:    Add               r2, r2, r1
+// CHECK-NEXT:    Mov               r0, r2
+// CHECK-NEXT:    AddNJLess         L2, r1, r1, r3, r4
+// CHECK-NEXT:L1:
+
+// CHECK-LABEL:Function<countDown>(2 params, 5 registers, 0 symbols):
+// CHECK:L2:
+// CHECK-NEXT:    Mul               r1, r1, r2
+// CHECK-NEXT:    Mov               r0, r1
+// CHECK-NEXT:    SubNJGreater      L2, r2, r2, r3, r3
+// CHECK-NEXT:L1:
+
+// CHECK-LABEL:Function<countDownTo>(3 params, 7 registers, 0 symbols):
+// CHECK:L2:
+// CHECK-NEXT:    AddN              r1, r1, r4
+// CHECK-NEXT:    Mov               r0, r1
+// CHECK-NEXT:    SubNJGreaterEqual L2, r2, r2, r3, r5
+// CHECK-NEXT:L1:
+
+// CHECK-LABEL:Function<countUpTo>(2 params, 6 registers, 0 symbols):
+// CHECK:L2:
+// CHECK-NEXT:    MulN              r2, r2, r1
+// CHECK-NEXT:    Mov               r0, r2
+// CHECK-NEXT:    AddNJLessEqual    L2, r1, r1, r3, r4
+// CHECK-NEXT:L1:
+
+// Superinstructions are disabled on request, and when compiling for the
+// debugger since they would merge two statements.
+
+// NOFUSE-LABEL:Function<countUp>(2 params, 6 registers, 0 symbols):
+// NOFUSE:    AddN              r1, r1, r3
+// NOFUSE:    JLess             L2, r1, r4
+// NOFUSE-LABEL:Function<countDown>(2 params, 5 registers, 0 symbols):
+// NOFUSE:    SubN              r2, r2, r3
+// NOFUSE:    JGreaterN         L2, r2, r3
+// NOFUSE-LABEL:Function<countDownTo>(3 params, 7 registers, 0 symbols):
+// NOFUSE:    SubN              r2, r2, r3
+// NOFUSE:    JGreaterEqual     L2, r2, r5
+// NOFUSE-LABEL:Function<countUpTo>(2 params, 6 registers, 0 symbols):
+// NOFUSE:    AddN              r1, r1, r3
+// NOFUSE:    JLessEqual        L2, r1, r4
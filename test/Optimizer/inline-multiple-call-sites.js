@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -target=HBC -O -dump-ir %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -target=HBC -O -fno-inline-multiple-call-sites -dump-ir %s | %FileCheck --match-full-lines --check-prefix=NOINLINE %s
+// RUN: %hermes -target=HBC -O -inline-profile=%S/Inputs/inline-profile.json -dump-ir %s | %FileCheck --match-full-lines --check-prefix=PROFILE %s
+
+// Small functions are inlined into all their call sites.
+function outer(a, b) {
+  function square(x) {
+    return x * x;
+  }
+  return square(a) + square(b);
+}
+//CHECK-LABEL:function outer(a, b) : number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = BinaryOperatorInst '*', %a, %a
+//CHECK-NEXT:  %1 = BinaryOperatorInst '*', %b, %b
+//CHECK-NEXT:  %2 = BinaryOperatorInst '+', %0 : number, %1 : number
+//CHECK-NEXT:  %3 = ReturnInst %2 : number
+//CHECK-NEXT:function_end
+
+//NOINLINE-LABEL:function outer(a, b) : number
+//NOINLINE-NEXT:frame = []
+//NOINLINE-NEXT:%BB0:
+//NOINLINE-NEXT:  %0 = CreateFunctionInst %square() : number
+//NOINLINE-NEXT:  %1 = CallInst %0 : closure, undefined : undefined, %a
+//NOINLINE-NEXT:  %2 = CallInst %0 : closure, undefined : undefined, %b
+
+//PROFILE-LABEL:function outer(a, b) : number
+//PROFILE-NEXT:frame = []
+//PROFILE-NEXT:%BB0:
+//PROFILE-NEXT:  %0 = BinaryOperatorInst '*', %a, %a
+//PROFILE-NEXT:  %1 = BinaryOperatorInst '*', %b, %b
+
+// Larger functions are only inlined into call sites which the profile shows
+// to be hot.
+function hot(a, b) {
+  function mix(x, y) {
+    var r = x * 31 + y;
+    r = r ^ (r >>> 7);
+    r = r * 17 + (r >>> 3);
+    r = r ^ (r << 11);
+    r = r * 13 + (r >>> 5);
+    return r & 0xffff;
+  }
+  return mix(a, b) + mix(b, a);
+}
+//CHECK-LABEL:function hot(a, b) : number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = CreateFunctionInst %mix() : number
+//CHECK-NEXT:  %1 = CallInst %0 : closure, undefined : undefined, %a, %b
+//CHECK-NEXT:  %2 = CallInst %0 : closure, undefined : undefined, %b, %a
+
+//PROFILE-LABEL:function hot(a, b) : number
+//PROFILE-NEXT:frame = []
+//PROFILE-NEXT:%BB0:
+//PROFILE-NEXT:  %0 = BinaryOperatorInst '*', %a, 31 : number
+//PROFILE:  %12 = BinaryOperatorInst '&', %11 : number, 65535 : number
+//PROFILE-NEXT:  %13 = BinaryOperatorInst '*', %b, 31 : number
+//PROFILE:  %25 = BinaryOperatorInst '&', %24 : number, 65535 : number
+//PROFILE-NEXT:  %26 = BinaryOperatorInst '+', %12 : number, %25 : number
+//PROFILE-NEXT:  %27 = ReturnInst %26 : number
+//PROFILE-NEXT:function_end
+
+// Call sites which were never executed according to the profile are not
+// inlined.
+function cold(a, b) {
+  function cube(x) {
+    return x * x * x;
+  }
+  return cube(a) - cube(b);
+}
+//CHECK-LABEL:function cold(a, b) : number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = BinaryOperatorInst '*', %a, %a
+//CHECK-NEXT:  %1 = BinaryOperatorInst '*', %0 : number, %a
+//CHECK-NEXT:  %2 = BinaryOperatorInst '*', %b, %b
+//CHECK-NEXT:  %3 = BinaryOperatorInst '*', %2 : number, %b
+//CHECK-NEXT:  %4 = BinaryOperatorInst '-', %1 : number, %3 : number
+//CHECK-NEXT:  %5 = ReturnInst %4 : number
+//CHECK-NEXT:function_end
+
+//PROFILE-LABEL:function cold(a, b) : number
+//PROFILE-NEXT:frame = []
+//PROFILE-NEXT:%BB0:
+//PROFILE-NEXT:  %0 = CreateFunctionInst %cube() : number
+//PROFILE-NEXT:  %1 = CallInst %0 : closure, undefined : undefined, %a
+//PROFILE-NEXT:  %2 = CallInst %0 : closure, undefined : undefined, %b
+
+// Functions with the same name have their own counts in the profile: only
+// the helper of twinHot is hot.
+function twinHot(a, b) {
+  function helper(x, y) {
+    var r = x * 31 + y;
+    r = r ^ (r >>> 7);
+    r = r * 17 + (r >>> 3);
+    r = r ^ (r << 11);
+    r = r * 13 + (r >>> 5);
+    return r & 0xffff;
+  }
+  return helper(a, b) + helper(b, a);
+}
+function twinCold(a, b) {
+  function helper(x, y) {
+    var r = x * 31 + y;
+    r = r ^ (r >>> 7);
+    r = r * 17 + (r >>> 3);
+    r = r ^ (r << 11);
+    r = r * 13 + (r >>> 5);
+    return r & 0xffff;
+  }
+  return helper(a, b) + helper(b, a);
+}
+
+//PROFILE-LABEL:function twinHot(a, b) : number
+//PROFILE-NEXT:frame = []
+//PROFILE-NEXT:%BB0:
+//PROFILE-NEXT:  %0 = BinaryOperatorInst '*', %a, 31 : number
+
+//PROFILE-LABEL:function twinCold(a, b) : number
+//PROFILE-NEXT:frame = []
+//PROFILE-NEXT:%BB0:
+//PROFILE-NEXT:  %0 = CreateFunctionInst %"helper 1#"() : number
+//PROFILE-NEXT:  %1 = CallInst %0 : closure, undefined : undefined, %a, %b
+//PROFILE-NEXT:  %2 = CallInst %0 : closure, undefined : undefined, %b, %a
@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -target=HBC -O -dump-ir %s | %FileCheck --match-full-lines %s
+
+// Loads and stores of the properties become SSA values.
+function point(a, b) {
+  var p = {x: a, y: b};
+  p.x += 1;
+  return p.x * p.y;
+}
+//CHECK-LABEL:function point(a, b) : number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = BinaryOperatorInst '+', %a, 1 : number
+//CHECK-NEXT:  %1 = BinaryOperatorInst '*', %0 : string|number, %b
+//CHECK-NEXT:  %2 = ReturnInst %1 : number
+//CHECK-NEXT:function_end
+
+// The length of a dense array is known.
+function tuple(a, b) {
+  var t = [a, b, 3];
+  return t[0] + t[1] + t[2] + t.length;
+}
+//CHECK-LABEL:function tuple(a, b) : string|number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = BinaryOperatorInst '+', %a, %b
+//CHECK-NEXT:  %1 = BinaryOperatorInst '+', %0 : string|number, 3 : number
+//CHECK-NEXT:  %2 = BinaryOperatorInst '+', %1 : string|number, 3 : number
+//CHECK-NEXT:  %3 = ReturnInst %2 : string|number
+//CHECK-NEXT:function_end
+
+// A fresh literal in every iteration.
+function loop(n) {
+  var s = 0;
+  for (var i = 0; i < n; ++i) {
+    var p = {a: i, b: i * 2};
+    s += p.a + p.b;
+  }
+  return s;
+}
+//CHECK-LABEL:function loop(n) : string|number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = BinaryOperatorInst '<', 0 : number, %n
+//CHECK-NEXT:  %1 = CondBranchInst %0 : boolean, %BB1, %BB2
+//CHECK-NEXT:%BB1:
+//CHECK-NEXT:  %2 = PhiInst 0 : number, %BB0, %6 : string|number, %BB1
+//CHECK-NEXT:  %3 = PhiInst 0 : number, %BB0, %7 : number, %BB1
+//CHECK-NEXT:  %4 = BinaryOperatorInst '*', %3 : number, 2 : number
+//CHECK-NEXT:  %5 = BinaryOperatorInst '+', %3 : number, %4 : number
+//CHECK-NEXT:  %6 = BinaryOperatorInst '+', %2 : string|number, %5 : number
+//CHECK-NEXT:  %7 = BinaryOperatorInst '+', %3 : number, 1 : number
+//CHECK-NEXT:  %8 = BinaryOperatorInst '<', %7 : number, %n
+//CHECK-NEXT:  %9 = CondBranchInst %8 : boolean, %BB1, %BB2
+//CHECK-NEXT:%BB2:
+//CHECK-NEXT:  %10 = PhiInst 0 : number, %BB0, %6 : string|number, %BB1
+//CHECK-NEXT:  %11 = ReturnInst %10 : string|number
+//CHECK-NEXT:function_end
+
+// Inlining exposes literals returned by the callee.
+function inlined(a, b) {
+  function make(x, y) {
+    return {x: x, y: y};
+  }
+  var r = make(a, b);
+  return r.x + r.y;
+}
+//CHECK-LABEL:function inlined(a, b) : string|number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = BinaryOperatorInst '+', %a, %b
+//CHECK-NEXT:  %1 = ReturnInst %0 : string|number
+//CHECK-NEXT:function_end
+
+// Literals which escape are kept.
+function escapes(a) {
+  var o = {v: a};
+  return o;
+}
+//CHECK-LABEL:function escapes(a) : object
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = AllocObjectInst 1 : number, empty
+//CHECK-NEXT:  %1 = StoreNewOwnPropertyInst %a, %0 : object, "v" : string, true : boolean
+//CHECK-NEXT:  %2 = ReturnInst %0 : object
+//CHECK-NEXT:function_end
+
+// Properties not initialized by the literal may come from the prototype.
+function inherited(a) {
+  var o = {v: a};
+  return o.toString;
+}
+//CHECK-LABEL:function inherited(a)
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = AllocObjectInst 1 : number, empty
+//CHECK-NEXT:  %1 = StoreNewOwnPropertyInst %a, %0 : object, "v" : string, true : boolean
+//CHECK-NEXT:  %2 = LoadPropertyInst %0 : object, "toString" : string
+//CHECK-NEXT:  %3 = ReturnInst %2
+//CHECK-NEXT:function_end
+
+// Arrays with holes are kept.
+function holes(a) {
+  var t = [a, , a];
+  return t[0];
+}
+//CHECK-LABEL:function holes(a)
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = AllocArrayInst 3 : number
+//CHECK-NEXT:  %1 = StoreOwnPropertyInst %a, %0 : object, 0 : number, true : boolean
+//CHECK-NEXT:  %2 = StoreOwnPropertyInst %a, %0 : object, 2 : number, true : boolean
+//CHECK-NEXT:  %3 = LoadPropertyInst %0 : object, 0 : number
+//CHECK-NEXT:  %4 = ReturnInst %3
+//CHECK-NEXT:function_end
+
+// Numeric keys which aren't array indices are kept.
+function nonIndexKeys(a) {
+  var o = {[1.5]: a, [-1]: 2};
+  return o[1.5] + o[-1];
+}
+//CHECK-LABEL:function nonIndexKeys(a) : string|number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = AllocObjectInst 2 : number, empty
+//CHECK-NEXT:  %1 = StoreOwnPropertyInst %a, %0 : object, 1.5 : number, true : boolean
+//CHECK-NEXT:  %2 = StoreOwnPropertyInst 2 : number, %0 : object, -1 : number, true : boolean
+//CHECK-NEXT:  %3 = LoadPropertyInst %0 : object, 1.5 : number
+//CHECK-NEXT:  %4 = LoadPropertyInst %0 : object, -1 : number
+//CHECK-NEXT:  %5 = BinaryOperatorInst '+', %3, %4
+//CHECK-NEXT:  %6 = ReturnInst %5 : string|number
+//CHECK-NEXT:function_end
+
+// The same property may not be named by both a number and a string.
+function mixedKeys(a) {
+  var o = {'1': a, [1]: 2};
+  return o[1] + o['1'];
+}
+//CHECK-LABEL:function mixedKeys(a) : string|number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = AllocObjectInst 2 : number, empty
+//CHECK-NEXT:  %1 = StoreNewOwnPropertyInst %a, %0 : object, "1" : string, true : boolean
+//CHECK-NEXT:  %2 = StoreOwnPropertyInst 2 : number, %0 : object, 1 : number, true : boolean
+//CHECK-NEXT:  %3 = LoadPropertyInst %0 : object, 1 : number
+//CHECK-NEXT:  %4 = LoadPropertyInst %0 : object, "1" : string
+//CHECK-NEXT:  %5 = BinaryOperatorInst '+', %3, %4
+//CHECK-NEXT:  %6 = ReturnInst %5 : string|number
+//CHECK-NEXT:function_end
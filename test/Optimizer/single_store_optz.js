@@ -5,7 +5,7 @@
  * LICENSE file in the root directory of this source tree.
  */
 
-// RUN: %hermes -hermes-parser -dump-ir %s     -O  | %FileCheck %s --match-full-lines
+// RUN: %hermes -hermes-parser -dump-ir %s     -O -fno-inline-multiple-call-sites | %FileCheck %s --match-full-lines
 
 //CHECK-LABEL:function g12(z) : undefined
 //CHECK-NEXT:frame = []
@@ -848,7 +848,33 @@ cons.forEach(function(TypedArray) {
   arr[1] = 50;
   assert.equal(arr.indexOf(50), 0);
   assert.equal(arr.lastIndexOf(50), 1);
+
+  // Values which the element type can't represent are never found.
+  assert.equal(arr.indexOf(50.5), -1);
+  assert.equal(arr.indexOf(1e300), -1);
+  assert.equal(arr.indexOf(-Infinity), -1);
+  assert.equal(arr.lastIndexOf(2, -10), -1);
+  assert.equal(arr.indexOf(-0), -1);
+  arr[3] = 0;
+  assert.equal(arr.indexOf(-0), 3);
+  assert.ok(arr.includes(-0));
 });
+
+(function nanIndexOf() {
+  [Float32Array, Float64Array].forEach(function(ta) {
+    var arr = new ta([1, NaN, 2, NaN, Infinity]);
+    assert.ok(arr.includes(NaN));
+    assert.ok(!arr.includes(NaN, 4));
+    assert.equal(arr.indexOf(NaN), -1);
+    assert.equal(arr.lastIndexOf(NaN), -1);
+    assert.equal(arr.indexOf(Infinity), 4);
+    assert.equal(arr.lastIndexOf(2, 3), 2);
+  });
+  assert.ok(!new Int32Array([0]).includes(NaN));
+  // The element is a float, which is not the same number as 0.1.
+  assert.equal(new Float32Array([0.1]).indexOf(0.1), -1);
+  assert.equal(new Float32Array([0.5]).indexOf(0.5), 0);
+})();
 /// @}
 
 /// @name TypedArray.prototype.join && .toString (since toString calls join)
@@ -968,6 +994,34 @@ cons.forEach(function(ta) {
   assert.equal(1 / x[1], +Infinity);
 })();
 
+(function nanSort() {
+  [Float32Array, Float64Array].forEach(function(ta) {
+    var x = new ta([NaN, 3, -0, Infinity, NaN, -Infinity, 0, -1.5]);
+    x.sort();
+    assert.equal(x[0], -Infinity);
+    assert.equal(x[1], -1.5);
+    assert.equal(1 / x[2], -Infinity);
+    assert.equal(1 / x[3], +Infinity);
+    assert.equal(x[4], 3);
+    assert.equal(x[5], Infinity);
+    assert.ok(isNaN(x[6]));
+    assert.ok(isNaN(x[7]));
+  });
+})();
+
+(function signedSort() {
+  cons.forEach(function(ta) {
+    var x = new ta([5, -1, 127, -128, 0, 100, 5]);
+    var expected = Array.prototype.slice.call(x).sort(function(a, b) {
+      return a - b;
+    });
+    x.sort();
+    for (var i = 0; i < x.length; i++) {
+      assert.equal(x[i], expected[i]);
+    }
+  });
+})();
+
 /// @}
 
 /// @name TypedArray.prototype.set
@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+
+// The iterating Array.prototype builtins read array elements directly from
+// storage. Holes must still be looked up in the prototype chain, and changes
+// made by the callbacks must be seen.
+
+print('array iteration');
+// CHECK-LABEL: array iteration
+
+var a = [1, 2, , 4];
+Array.prototype[2] = 'p';
+a.forEach(function(v, i) {
+  print(i, v);
+});
+// CHECK-NEXT: 0 1
+// CHECK-NEXT: 1 2
+// CHECK-NEXT: 2 p
+// CHECK-NEXT: 3 4
+print(a.map(function(v) { return v + 1; }).join());
+// CHECK-NEXT: 2,3,p1,5
+print(a.indexOf('p'), a.lastIndexOf('p'), a.includes('p'));
+// CHECK-NEXT: 2 2 true
+print(a.find(function(v) { return v === 'p'; }), a.slice(1, 3).join());
+// CHECK-NEXT: p 2,p
+delete Array.prototype[2];
+print(a.indexOf(undefined), a.includes(undefined), a.slice(2).length);
+// CHECK-NEXT: -1 true 2
+
+// The callbacks shrink, grow and overwrite the array being iterated.
+var b = [1, 2, 3, 4];
+print(b.filter(function(v, i, o) {
+  if (i === 0) o.length = 2;
+  return true;
+}).join());
+// CHECK-NEXT: 1,2
+var c = [1, 2, 3];
+print(c.reduce(function(x, y, i, o) {
+  o[2] = 10;
+  return x + y;
+}));
+// CHECK-NEXT: 13
+var d = [1, 2, 3];
+print(d.every(function(v, i, o) {
+  if (i === 0) {
+    Object.defineProperty(o, 1, {
+      get: function() { return 'getter'; },
+    });
+  }
+  print(v);
+  return true;
+}));
+// CHECK-NEXT: 1
+// CHECK-NEXT: getter
+// CHECK-NEXT: 3
+// CHECK-NEXT: true
+print([1, 2, 3].reduceRight(function(x, y) { return x + '-' + y; }));
+// CHECK-NEXT: 3-2-1
+print([NaN].includes(NaN), [NaN].indexOf(NaN));
+// CHECK-NEXT: true -1
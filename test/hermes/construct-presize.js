@@ -0,0 +1,53 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O0 %s | %FileCheck --match-full-lines %s
+"use strict";
+
+print('construct-presize');
+// CHECK-LABEL: construct-presize
+
+// Objects created after the first construct call have their property storage
+// preallocated. Make sure the preallocated slots are not visible.
+function Point(n) {
+  this.seen = 'p0' in this;
+  for (var i = 0; i < n; ++i)
+    this['p' + i] = i;
+}
+
+var objs = [];
+for (var i = 0; i < 4; ++i)
+  objs.push(new Point(10 - i * 3));
+for (var i = 0; i < objs.length; ++i)
+  print(Object.keys(objs[i]).length, objs[i].seen, objs[i].p9, objs[i].p3);
+// CHECK-NEXT: 11 false 9 3
+// CHECK-NEXT: 8 false undefined 3
+// CHECK-NEXT: 5 false undefined 3
+// CHECK-NEXT: 2 false undefined undefined
+
+var p = new Point(12);
+delete p.p0;
+p.extra = 'x';
+print(Object.keys(p).join());
+// CHECK-NEXT: seen,p1,p2,p3,p4,p5,p6,p7,p8,p9,p10,p11,extra
+print(JSON.stringify(new Point(3)));
+// CHECK-NEXT: {"seen":false,"p0":0,"p1":1,"p2":2}
+
+// A constructor returning a different object.
+function Other() {
+  this.a = 1;
+  this.b = 2;
+  return {c: 3};
+}
+print(JSON.stringify(new Other()), JSON.stringify(new Other()));
+// CHECK-NEXT: {"c":3} {"c":3}
+
+// Construct calls through a bound function use the same feedback.
+var r = new (Point.bind(null, 6))();
+print(r instanceof Point, Object.keys(r).length, r.p5);
+// CHECK-NEXT: true 7 5
@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O0 %s | %FileCheck --match-full-lines %s
+
+// Element accesses which the interpreter does directly on the storage of
+// arrays and typed arrays, and the cases where it must not.
+
+print('element access');
+// CHECK-LABEL: element access
+
+var a = [1, 2, 3];
+a[1] = 20;
+print(a[0], a[1], a[2], a[3]);
+// CHECK-NEXT: 1 20 3 undefined
+
+// Holes are looked up in the prototype chain, and stores to them go
+// through its setters.
+var holes = [0, , 2];
+Array.prototype[1] = 'proto';
+print(holes[1]);
+// CHECK-NEXT: proto
+delete Array.prototype[1];
+Object.defineProperty(Array.prototype, 1, {
+  set: function(v) { print('setter', v); },
+  configurable: true,
+});
+holes[1] = 5;
+// CHECK-NEXT: setter 5
+print(holes.hasOwnProperty(1));
+// CHECK-NEXT: false
+delete Array.prototype[1];
+
+// Stores past the end grow the array.
+var grow = [1];
+grow[3] = 4;
+print(grow.length, grow[3]);
+// CHECK-NEXT: 4 4
+
+// Frozen arrays are not written.
+var frozen = Object.freeze([1, 2]);
+frozen[0] = 10;
+print(frozen[0]);
+// CHECK-NEXT: 1
+(function() {
+  'use strict';
+  try {
+    frozen[0] = 10;
+  } catch (e) {
+    print(e.name);
+  }
+})();
+// CHECK-NEXT: TypeError
+
+// Index-like accessors on the array itself are called.
+var acc = [1, 2, 3];
+Object.defineProperty(acc, 0, {
+  get: function() { return 'getter'; },
+  set: function(v) { print('own setter', v); },
+});
+print(acc[0]);
+// CHECK-NEXT: getter
+acc[0] = 7;
+// CHECK-NEXT: own setter 7
+
+// Non-index keys.
+var keys = [1, 2];
+print(keys['1'], keys[1.5], keys[-1]);
+// CHECK-NEXT: 2 undefined undefined
+
+// Typed arrays convert the stored value, and ignore out of bounds stores.
+var i8 = new Int8Array(2);
+i8[0] = 200;
+i8[1] = '3';
+i8[5] = 1;
+print(i8[0], i8[1], i8[5], i8.length);
+// CHECK-NEXT: -56 3 undefined 2
+var c8 = new Uint8ClampedArray(1);
+c8[0] = 300;
+print(c8[0]);
+// CHECK-NEXT: 255
+var f32 = new Float32Array(1);
+f32[0] = 0.1;
+print(f32[0] === Math.fround(0.1));
+// CHECK-NEXT: true
+var f64 = new Float64Array(1);
+f64[0] = NaN;
+print(f64[0]);
+// CHECK-NEXT: NaN
+var u32 = new Uint32Array([1, 2, 3, 4]);
+var sub = u32.subarray(1, 3);
+sub[0] = -1;
+print(sub[0], sub[1], sub[2], u32[1]);
+// CHECK-NEXT: 4294967295 3 undefined 4294967295
@@ -0,0 +1,25 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O -gc-background-finalization %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O -gc-background-finalization -gc-print-stats %s 2>&1 | %FileCheck --check-prefix=STATS %s
+
+// Objects with native resources can be released off the main thread.
+print('background finalization');
+// CHECK-LABEL: background finalization
+
+var sum = 0;
+for (var i = 0; i < 2000; i++) {
+  var buf = new ArrayBuffer(64 * 1024);
+  var view = new Uint8Array(buf);
+  view[i] = i & 0xff;
+  sum += view[i];
+}
+print(sum);
+// CHECK-NEXT: 250008
+
+// STATS: "backgroundReleases": {{[1-9][0-9]*}},
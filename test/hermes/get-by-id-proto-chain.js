@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O0 %s | %FileCheck --match-full-lines %s
+"use strict";
+
+print('get-by-id-proto-chain');
+// CHECK-LABEL: get-by-id-proto-chain
+
+function getFoo(o) {
+  return o.foo;
+}
+function getAll(objs) {
+  var res = [];
+  for (var i = 0; i < objs.length; ++i)
+    res.push(getFoo(objs[i]));
+  return res.join();
+}
+
+// Build a chain obj -> c -> b -> a, with the property on a.
+var a = {foo: 'a'};
+var b = Object.create(a);
+var c = Object.create(b);
+var obj = Object.create(c);
+var objs = [obj, obj, obj];
+print(getAll(objs));
+// CHECK-NEXT: a,a,a
+
+// Shadow the property on a prototype in the middle of the chain.
+b.foo = 'b';
+print(getAll(objs));
+// CHECK-NEXT: b,b,b
+delete b.foo;
+print(getAll(objs));
+// CHECK-NEXT: a,a,a
+
+// Change the value and then the shape of the holder.
+a.foo = 'a2';
+print(getAll(objs));
+// CHECK-NEXT: a2,a2,a2
+a.bar = 1;
+delete a.foo;
+print(getAll(objs));
+// CHECK-NEXT: ,,
+
+// A different chain whose holder has the same hidden class.
+a.foo = 'a3';
+var other = Object.create(Object.create(Object.create({foo: 'x', bar: 2})));
+print(getAll([obj, other, obj, other]));
+// CHECK-NEXT: a3,x,a3,x
+
+// Change the prototype of an object in the middle of the chain.
+Object.setPrototypeOf(c, {foo: 'new'});
+print(getAll(objs));
+// CHECK-NEXT: new,new,new
+
+// Accessors on the chain are not cached.
+var n = 0;
+Object.defineProperty(b, 'foo', {
+  get: function() {
+    return 'get' + ++n;
+  },
+  configurable: true,
+});
+Object.setPrototypeOf(c, b);
+print(getAll(objs));
+// CHECK-NEXT: get1,get2,get3
+
+// Deep class hierarchies and Object.prototype methods.
+function Base() {}
+Base.prototype.hello = function() {
+  return 'hello';
+};
+function Derived() {}
+Derived.prototype = Object.create(Base.prototype);
+function MoreDerived() {}
+MoreDerived.prototype = Object.create(Derived.prototype);
+var res = [];
+for (var i = 0; i < 3; ++i) {
+  var md = new MoreDerived();
+  res.push(md.hello(), md.hasOwnProperty('hello'));
+}
+print(res.join());
+// CHECK-NEXT: hello,false,hello,false,hello,false
+Derived.prototype.hello = function() {
+  return 'derived';
+};
+print(new MoreDerived().hello());
+// CHECK-NEXT: derived
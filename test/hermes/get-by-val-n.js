@@ -0,0 +1,54 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O0 %s | %FileCheck --match-full-lines %s
+"use strict";
+
+print('get-by-val-n');
+// CHECK-LABEL: get-by-val-n
+
+function readAt(obj, n, step) {
+  var res = [];
+  for (var i = -1; i < n; i += step)
+    res.push(obj[i]);
+  return res.join();
+}
+
+var arr = [10, , 30];
+Object.prototype[1] = 'proto';
+Object.prototype[-1] = 'neg';
+Object.prototype[0.5] = 'half';
+print(readAt(arr, 4, 1));
+// CHECK-NEXT: neg,10,proto,30,
+print(readAt(arr, 1, 0.5));
+// CHECK-NEXT: neg,,10,half
+print(readAt('xyz', 3, 1));
+// CHECK-NEXT: neg,x,y,z
+delete Object.prototype[1];
+delete Object.prototype[-1];
+delete Object.prototype[0.5];
+print(readAt(new Int16Array([7, 8]), 3, 1));
+// CHECK-NEXT: ,7,8,
+
+function writeAt(obj, n) {
+  for (var i = 0; i < n; ++i)
+    obj[i] = i * 1.5;
+  return obj;
+}
+print(writeAt([], 3).join(), writeAt(new Uint8Array(2), 3).join());
+// CHECK-NEXT: 0,1.5,3 0,1
+print(JSON.stringify(writeAt({}, 2)));
+// CHECK-NEXT: {"0":0,"1":1.5}
+
+var frozen = Object.freeze([1, 2]);
+try {
+  writeAt(frozen, 1);
+} catch (e) {
+  print(e.name);
+}
+// CHECK-NEXT: TypeError
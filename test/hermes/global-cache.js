@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O0 %s | %FileCheck --match-full-lines %s
+
+print('global-cache');
+// CHECK-LABEL: global-cache
+
+var g = this;
+// Put the global object well past the dictionary threshold.
+for (var i = 0; i < 200; ++i)
+  g['extra' + i] = i;
+
+var declared = 1;
+g.assigned = 2;
+
+function read() {
+  return declared + ',' + assigned;
+}
+function write(a, b) {
+  declared = a;
+  assigned = b;
+}
+function strictWrite(v) {
+  'use strict';
+  try {
+    declared = v;
+  } catch (e) {
+    return e.name;
+  }
+  return 'ok';
+}
+
+for (var i = 0; i < 3; ++i) {
+  write(i, i * 10);
+  print(read());
+}
+// CHECK-NEXT: 0,0
+// CHECK-NEXT: 1,10
+// CHECK-NEXT: 2,20
+
+// Delete a global and then bring it back.
+delete g.assigned;
+try {
+  read();
+} catch (e) {
+  print(e.name);
+}
+// CHECK-NEXT: ReferenceError
+g.assigned = 'back';
+print(read());
+// CHECK-NEXT: 2,back
+
+// Delete other globals: accesses keep working and keep being cached.
+for (var i = 0; i < 50; ++i)
+  delete g['extra' + i];
+write(3, 30);
+print(read(), extra199);
+// CHECK-NEXT: 3,30 199
+
+// Redefine a global as read-only: cached writes must not bypass it.
+Object.defineProperty(g, 'declared', {writable: false});
+write(4, 40);
+print(read(), strictWrite(5));
+// CHECK-NEXT: 3,40 TypeError
+
+// Redefine a global as an accessor.
+Object.defineProperty(g, 'assigned', {
+  get: function() {
+    return 'getter';
+  },
+  set: function(v) {
+    print('setter', v);
+  },
+});
+write(6, 60);
+// CHECK-NEXT: setter 60
+print(read());
+// CHECK-NEXT: 3,getter
+
+// Freeze the global object: cached writes must not bypass it.
+Object.freeze(g);
+write(7, 70);
+// CHECK-NEXT: setter 70
+g.extra199 = 0;
+print(read(), extra199, Object.isFrozen(g), strictWrite(8));
+// CHECK-NEXT: 3,getter 199 true TypeError
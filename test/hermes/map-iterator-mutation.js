@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O -gc-max-heap=8M %s | %FileCheck --match-full-lines %s
+
+// Iterators of Map and Set must keep their position while elements are
+// added and removed, including when the table is rebuilt.
+
+print('map-iterator-mutation');
+// CHECK-LABEL: map-iterator-mutation
+
+function range(n) {
+  var s = new Set();
+  for (var i = 0; i < n; i++) s.add(i);
+  return s;
+}
+
+function collect(it) {
+  var out = [];
+  for (var r = it.next(); !r.done; r = it.next()) out.push(r.value);
+  return out;
+}
+
+// Delete the next elements and re-add the current one while iterating.
+var s = range(5);
+var seen = [];
+s.forEach(function(v) {
+  seen.push(v);
+  if (v === 1 && seen.length === 2) {
+    s.delete(2);
+    s.delete(1);
+    s.add(1);
+  }
+});
+print(seen.join());
+// CHECK-NEXT: 0,1,3,4,1
+
+// Delete almost everything while iterating, which shrinks the table.
+var s = range(1000);
+var it = s.values();
+print(it.next().value, it.next().value);
+// CHECK-NEXT: 0 1
+for (var i = 0; i < 995; i++) s.delete(i);
+print(collect(it).join(), s.size);
+// CHECK-NEXT: 995,996,997,998,999 5
+
+// Grow the set a lot while iterating.
+var s = range(3);
+var it = s.values();
+it.next();
+for (var i = 3; i < 5000; i++) s.add(i);
+var rest = collect(it);
+print(rest.length, rest[0], rest[rest.length - 1]);
+// CHECK-NEXT: 4999 1 4999
+
+// Delete and re-add while iterating, so that the table is rebuilt to drop
+// the deleted elements, and check every element is seen once.
+var s = range(100);
+var seen = 0;
+var sum = 0;
+s.forEach(function(v) {
+  seen++;
+  sum += v;
+  if (v < 100) {
+    s.delete(v);
+    s.add(v + 100);
+  }
+});
+print(seen, sum, s.size);
+// CHECK-NEXT: 200 19900 100
+
+// Clearing moves an iterator to the end, and it continues with new elements.
+var m = new Map([['a', 1], ['b', 2], ['c', 3]]);
+var it = m.entries();
+print(it.next().value);
+// CHECK-NEXT: a,1
+m.clear();
+m.set('d', 4);
+print(collect(it).join(';'));
+// CHECK-NEXT: d,4
+
+// Iterators which finished stay finished.
+var m = new Map([[1, 1]]);
+var it = m.keys();
+print(collect(it).length);
+// CHECK-NEXT: 1
+m.set(2, 2);
+print(it.next().done);
+// CHECK-NEXT: true
+
+// Several iterators over the same map at different positions.
+var m = new Map();
+for (var i = 0; i < 20; i++) m.set(i, i * i);
+var its = [m.values(), m.values(), m.values()];
+for (var i = 0; i < 3; i++) {
+  for (var j = 0; j < i * 5; j++) its[i].next();
+}
+for (var i = 0; i < 18; i++) m.delete(i);
+m.set(20, 400);
+print(collect(its[0]).join(), collect(its[1]).join(), collect(its[2]).join());
+// CHECK-NEXT: 324,361,400 324,361,400 324,361,400
+
+// Keys are compared with SameValueZero.
+var m = new Map();
+m.set(NaN, 'nan');
+m.set(-0, 'zero');
+m.set('1', 'string');
+m.set(1, 'number');
+print(m.get(NaN), m.get(0), m.get('1'), m.get(1), m.size);
+// CHECK-NEXT: nan zero string number 4
+
+// Clearing a map which grew, while an iterator is in the middle of it.
+var s = new Set();
+for (var i = 0; i < 1000; i++) s.add(i);
+var it = s.values();
+it.next();
+s.clear();
+for (var i = 0; i < 3; i++) s.add('x' + i);
+print(s.size, s.has(5), s.has('x1'), collect(it).join());
+// CHECK-NEXT: 3 false true x0,x1,x2
@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+
+// Builtins which call a callback in a loop reuse the callee frame between the
+// calls. Each call must see its own arguments and this, even when the previous
+// call overwrote them.
+
+print('prepared call');
+// CHECK-LABEL: prepared call
+
+[1, 2, 3].forEach(function(v, i, arr) {
+  print(v, i, arr.length, this.tag);
+  v = 'x';
+  i = -1;
+  arr = null;
+  arguments[0] = 'y';
+}, {tag: 't'});
+// CHECK-NEXT: 1 0 3 t
+// CHECK-NEXT: 2 1 3 t
+// CHECK-NEXT: 3 2 3 t
+
+print([1, 2, 3, 4].reduce(function(acc, v) {
+  acc = acc + v;
+  return acc;
+}));
+// CHECK-NEXT: 10
+
+// Native and bound callees.
+print(['1', '2.5', 'z'].map(Number));
+// CHECK-NEXT: 1,2.5,NaN
+print([1, 2].map(function(a, b) { return this + a + b; }.bind(10)));
+// CHECK-NEXT: 11,13
+
+// Builtins with callbacks called from callbacks.
+print([[3, 1, 2], [5, 4]].map(function(a) {
+  return a.map(function(v) { return v * 2; }).sort(function(x, y) {
+    return y - x;
+  });
+}).join(';'));
+// CHECK-NEXT: 6,4,2;10,8
+
+// A callback which throws.
+try {
+  [1, 2, 3].some(function(v) {
+    if (v === 2)
+      throw new Error('stop at ' + v);
+    return false;
+  });
+} catch (e) {
+  print(e.message);
+}
+// CHECK-NEXT: stop at 2
+print([1, 2, 3].filter(function(v) { return v !== 2; }));
+// CHECK-NEXT: 1,3
+
+// Recursion through the same builtin.
+function depth(a) {
+  return a.reduce(function(m, v) {
+    return Math.max(m, Array.isArray(v) ? 1 + depth(v) : 0);
+  }, 0);
+}
+print(depth([1, [2, [3, [4]]], [5]]));
+// CHECK-NEXT: 3
+
+print([5, 1, 4].find(function(v, i) { return i === 2; }));
+// CHECK-NEXT: 4
+
+print(JSON.stringify(JSON.parse('{"a":1,"b":[2,{"c":3}]}', function(k, v) {
+  return typeof v === 'number' ? v * 10 : v;
+})));
+// CHECK-NEXT: {"a":10,"b":[20,{"c":30}]}
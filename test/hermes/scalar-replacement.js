@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O0 %s | %FileCheck --match-full-lines %s
+
+// Object and array literals which don't escape behave the same when they are
+// replaced by scalars.
+
+function point(a, b) {
+  var p = {x: a, y: b};
+  p.x += 1;
+  return p.x * p.y;
+}
+print(point(2, 5));
+//CHECK: 15
+
+function loop(n) {
+  var s = 0;
+  for (var i = 0; i < n; ++i) {
+    var p = {a: i, b: i * 2};
+    if (i & 1)
+      p.a = p.b;
+    s += p.a;
+  }
+  return s;
+}
+print(loop(10));
+//CHECK-NEXT: 70
+
+function tuple(a, b) {
+  var t = [a, b, a + b];
+  return t[0] * t[1] * t[2] + t.length;
+}
+print(tuple(2, 3));
+//CHECK-NEXT: 33
+
+function destructure(a, b) {
+  var {x, y} = {x: a, y: b};
+  return x - y;
+}
+print(destructure(10, 3));
+//CHECK-NEXT: 7
+
+function cond(a, b, c) {
+  var o = {v: c ? a : b};
+  return o.v;
+}
+print(cond(1, 2, true), cond(1, 2, false));
+//CHECK-NEXT: 1 2
+
+function duplicate(a) {
+  var o = {v: 1, w: a, v: a + 1};
+  return o.v + o.w;
+}
+print(duplicate(5));
+//CHECK-NEXT: 11
+
+// Properties which are not initialized by the literal may come from the
+// prototype.
+function inherited(a) {
+  var o = {v: a};
+  return typeof o.toString + " " + o.v;
+}
+print(inherited(3));
+//CHECK-NEXT: function 3
+
+function withProto(p) {
+  var o = {__proto__: p, v: 1};
+  return o.v + o.w;
+}
+print(withProto({w: 2}));
+//CHECK-NEXT: 3
+
+// Arrays with holes don't have all their elements.
+function holes(a) {
+  var t = [a, , a];
+  return t.length + " " + t[1];
+}
+print(holes(1));
+//CHECK-NEXT: 3 undefined
+
+function trailingHole(a) {
+  var t = [a, a, ];
+  var u = [a, , ];
+  return t.length + " " + u.length;
+}
+print(trailingHole(1));
+//CHECK-NEXT: 2 2
+
+function getter(a) {
+  var o = {get v() { return a * 2; }};
+  return o.v;
+}
+print(getter(4));
+//CHECK-NEXT: 8
+
+function numericKeys(a) {
+  var o = {0: a, 1: a + 1};
+  return o[0] + o[1];
+}
+print(numericKeys(4));
+//CHECK-NEXT: 9
@@ -0,0 +1,54 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+"use strict";
+
+// Long substrings share the storage of the sliced string. Check that they
+// behave like any other string.
+
+print('sliced-strings');
+// CHECK-LABEL: sliced-strings
+
+var base = 'abcdefghijklmnopqrstuvwxyz0123456789'.repeat(4);
+var s1 = base.substring(3, 103);
+var s2 = s1.slice(10, 60);
+var s3 = base.substr(13, 50);
+print(s1.length, s2.length, s2 === s3, s2 == base.substring(13, 63));
+// CHECK-NEXT: 100 50 true true
+print(s2);
+// CHECK-NEXT: nopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz0
+
+// As property keys.
+var obj = {};
+obj[s2] = 1;
+print(obj[s3], Object.keys(obj)[0] === s2);
+// CHECK-NEXT: 1 true
+
+// Concatenation and comparison.
+print((s2 + '!').length, s2 < s1, s2.charCodeAt(49), s2.indexOf('z0'));
+// CHECK-NEXT: 51 false 48 12
+
+// UTF-16 strings.
+var u = ('ሴ' + base).repeat(2);
+var us = u.substring(1, 80).substring(5, 70);
+print(us.length, us.charCodeAt(0), us === base.substring(5, 70));
+// CHECK-NEXT: 65 102 true
+
+// Pieces of split.
+var parts = (base + ',' + base + ',' + base).split(',');
+print(parts.length, parts[1] === base, parts[2].length);
+// CHECK-NEXT: 3 true 144
+
+// Slices survive garbage collection of everything but themselves.
+var kept = [];
+for (var i = 0; i < 1000; ++i) {
+  kept.push(('x' + i + base).substring(2, 80));
+}
+gc();
+print(kept[999].substring(0, 10), kept[0].substring(0, 10));
+// CHECK-NEXT: 99abcdefgh abcdefghij
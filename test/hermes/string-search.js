@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+"use strict";
+
+// Substring search in haystacks long enough to use the skip table, and with
+// every combination of ASCII and UTF-16 haystacks and needles.
+
+print('string-search');
+// CHECK-LABEL: string-search
+
+var filler = 'abcabcabd'.repeat(200);
+var hay = filler + 'needle in a haystack' + filler + 'needle in a haystack';
+var hay16 = 'š' + hay;
+var needle = 'needle in a haystack';
+var needle16 = 'needle in a Ũaystack';
+
+print(hay.indexOf(needle), hay.indexOf(needle, 1801),
+      hay.indexOf(needle, 3621));
+// CHECK-NEXT: 1800 3620 -1
+print(hay.lastIndexOf(needle), hay.lastIndexOf(needle, 3619));
+// CHECK-NEXT: 3620 1800
+print(hay16.indexOf(needle), hay16.lastIndexOf(needle));
+// CHECK-NEXT: 1801 3621
+print(hay.indexOf(needle16), hay16.indexOf(needle16));
+// CHECK-NEXT: -1 -1
+print(hay.indexOf('abcabd'), hay.lastIndexOf('abcabd'), hay16.indexOf('d'));
+// CHECK-NEXT: 3 3614 9
+print(hay.includes('abd' + needle), hay16.includes('šabc'));
+// CHECK-NEXT: true true
+print(hay.includes('abc' + needle), hay.includes(needle, 3621));
+// CHECK-NEXT: false false
+
+var parts = hay16.split(needle);
+print(parts.length, parts[0].length, parts[1].length, parts[2].length);
+// CHECK-NEXT: 3 1801 1800 0
+print(hay.split('abd').length, hay16.split('š').length);
+// CHECK-NEXT: 401 2
+
+var replaced = hay16.replace(needle, '!');
+print(replaced.length, replaced.indexOf('!'));
+// CHECK-NEXT: 3622 1801
+
+// A UTF-16 code unit whose low byte matches an ASCII character.
+print('abcd'.indexOf('ţd'), 'ţd'.indexOf('cd'));
+// CHECK-NEXT: -1 -1
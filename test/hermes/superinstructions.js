@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O -fno-superinstructions %s | %FileCheck --match-full-lines %s
+"use strict";
+
+print('superinstructions');
+// CHECK-LABEL: superinstructions
+
+function countUp(n) {
+  var sum = 0;
+  for (var i = 0; i < n; ++i)
+    sum += i;
+  return sum;
+}
+print(countUp(10), countUp(0), countUp(NaN), countUp("3"));
+// CHECK-NEXT: 45 0 0 3
+
+function countUpTo(n) {
+  var count = 0;
+  for (var i = 0; i <= n; i += 0.5)
+    ++count;
+  return count;
+}
+print(countUpTo(2), countUpTo({valueOf: function() { return 1; }}));
+// CHECK-NEXT: 5 3
+
+function countDown(n) {
+  var sum = 0;
+  while (--n > 0)
+    sum += n;
+  return sum;
+}
+print(countDown(5), countDown(-1), countDown("4"));
+// CHECK-NEXT: 10 0 6
+
+function countDownTo(n, limit) {
+  var count = 0;
+  while (--n >= limit)
+    ++count;
+  return count;
+}
+print(countDownTo(5, 0), countDownTo(5, "2"), countDownTo(5, undefined));
+// CHECK-NEXT: 5 3 0
+
+try {
+  countDownTo(3, {valueOf: function() { throw new Error("valueOf"); }});
+} catch (e) {
+  print(e.message);
+}
+// CHECK-NEXT: valueOf
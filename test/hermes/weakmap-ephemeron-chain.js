@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O -Xhermes-internal-test-methods %s | %FileCheck --match-full-lines %s
+
+"use strict";
+
+// Long chains of WeakMap entries, where each value is the key of the next
+// entry, either in the same map or spread over many maps.  Only the entries
+// reachable from the head of a chain survive a collection.
+print("Start");
+// CHECK-LABEL: Start
+
+var reachableKey = {};
+
+function sameMapChain(head, length) {
+  var map = new WeakMap();
+  var key = head;
+  for (var i = 0; i < length; i++) {
+    var next = {};
+    map.set(key, next);
+    key = next;
+  }
+  return map;
+}
+
+var map = sameMapChain(reachableKey, 20000);
+gc();
+// CHECK-NEXT: 20000
+print(HermesInternal.getWeakSize(map));
+
+function unreachableChain(length) {
+  return sameMapChain({}, length);
+}
+map = unreachableChain(20000);
+gc();
+// CHECK-NEXT: 0
+print(HermesInternal.getWeakSize(map));
+
+// Each map holds one link of the chain; the maps are listed in reverse order,
+// so that a map is always scanned before the key of its entry is marked.
+function manyMapsChain(head, length) {
+  var maps = [];
+  for (var i = 0; i < length; i++) maps.push(new WeakMap());
+  var key = head;
+  for (var i = length - 1; i >= 0; i--) {
+    var next = {};
+    maps[i].set(key, next);
+    // An unreachable cycle in every map.
+    var garbage = {};
+    maps[i].set(garbage, garbage);
+    key = next;
+  }
+  return maps;
+}
+
+function totalSize(maps) {
+  var total = 0;
+  for (var i = 0; i < maps.length; i++)
+    total += HermesInternal.getWeakSize(maps[i]);
+  return total;
+}
+
+var maps = manyMapsChain(reachableKey, 2000);
+gc();
+// CHECK-NEXT: 2000
+print(totalSize(maps));
+
+// A chain which goes through the maps themselves: every map is the key of
+// the next map in the previous one.
+function mapsAsKeys(length) {
+  var first = new WeakMap();
+  var map = first;
+  for (var i = 1; i < length; i++) {
+    var next = new WeakMap();
+    map.set(map, next);
+    map = next;
+  }
+  map.set(map, {});
+  return first;
+}
+
+var first = mapsAsKeys(1000);
+gc();
+var n = 0;
+for (var m = first; m instanceof WeakMap; m = m.get(m)) n++;
+// CHECK-NEXT: 1000
+print(n);
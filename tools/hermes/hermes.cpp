@@ -69,6 +69,33 @@ static opt<bool> GCRevertToYGAtTTI(
     cat(GCCategory),
     init(false));
 
+static opt<bool> GCBackgroundFinalization(
+    "gc-background-finalization",
+    desc("Release the native resources of finalized objects on a background "
+         "thread"),
+    cat(GCCategory),
+    init(false));
+
+static opt<bool> GCHugePages(
+    "gc-huge-pages",
+    desc("Ask the OS to back heap segments with transparent huge pages"),
+    cat(GCCategory),
+    init(false));
+
+static opt<bool> GCPrefaultSegments(
+    "gc-prefault-segments",
+    desc("With -gc-huge-pages, fault in heap segments when they are "
+         "allocated"),
+    cat(GCCategory),
+    init(false));
+
+static opt<bool> GCPreferLocalNUMANode(
+    "gc-prefer-local-numa-node",
+    desc("With -gc-huge-pages, prefer allocating heap segments on the NUMA "
+         "node of the runtime thread"),
+    cat(GCCategory),
+    init(false));
+
 static opt<bool> GCBeforeStats(
     "gc-before-stats",
     desc("Perform a full GC just before printing statistics at exit"),
@@ -113,6 +140,10 @@ static int executeHBCBytecodeFromCL(
                   .withShouldReleaseUnused(vm::kReleaseUnusedNone)
                   .withAllocInYoung(cl::GCAllocYoung)
                   .withRevertToYGAtTTI(cl::GCRevertToYGAtTTI)
+                  .withBackgroundFinalization(cl::GCBackgroundFinalization)
+                  .withHugePageSegments(cl::GCHugePages)
+                  .withPrefaultSegments(cl::GCPrefaultSegments)
+                  .withPreferLocalNUMANode(cl::GCPreferLocalNUMANode)
                   .build())
           .withEnableJIT(cl::DumpJITCode || cl::EnableJIT)
           .withEnableEval(cl::EnableEval)
@@ -0,0 +1,28 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @format
+ */
+
+(function() {
+  var numIter = 2000;
+  var len = 10000;
+  var a = Array(len);
+  for (var i = 0; i < len; i++) {
+    a[i] = i;
+  }
+
+  var sum = 0;
+  function add(value) {
+    sum += value;
+  }
+
+  for (var i = 0; i < numIter; i++) {
+    a.forEach(add);
+  }
+
+  print('done');
+})();
@@ -0,0 +1,28 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @format
+ */
+
+// Access the properties of an ordinary object with integer keys, which are
+// converted to strings to look up the property.
+(function() {
+  var numIter = 2000;
+  var numKeys = 1000;
+  var o = {};
+  for (var k = 0; k < numKeys; k++) {
+    o[k] = k;
+  }
+
+  var sum = 0;
+  for (var i = 0; i < numIter; i++) {
+    for (var k = 0; k < numKeys; k++) {
+      sum += o[k];
+    }
+  }
+
+  print(sum);
+})();
@@ -7,6 +7,12 @@
 
 "use strict";
 
+// Simple arithmetic loops measuring the instruction dispatch overhead of the
+// interpreter. The back edge of every loop updates a counter and compares it,
+// which hermes -O emits as a single superinstruction. To see the difference in
+// the number of dispatched opcodes, run with a VM built with
+// HERMESVM_PROFILER_OPCODE, with and without -fno-superinstructions.
+
 var logger = typeof print === "undefined"
     ? console.log
     : print;
@@ -24,4 +30,17 @@ function bench (lc, fc) {
     return res;
 }
 
+function benchUp (lc, fc) {
+    var i, n, fact;
+    var res = 0;
+    for (i = 0; i < lc; ++i) {
+        fact = 1;
+        for (n = 2; n <= fc; ++n)
+            fact *= n;
+        res += fact;
+    }
+    return res;
+}
+
 logger(bench(4e6, 100))
+logger(benchUp(4e6, 100))
@@ -19,4 +19,19 @@ def bench(lc, fc):
     return res
 
 
+def bench_up(lc, fc):
+    res = 0.0
+    i = 0.0
+    while i < lc:
+        fact = 1.0
+        n = 2.0
+        while n <= fc:
+            fact *= n
+            n += 1.0
+        res += fact
+        i += 1.0
+    return res
+
+
 print(bench(float(4e5), 100.0))
+print(bench_up(float(4e5), 100.0))
@@ -0,0 +1,43 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @format
+ */
+
+// Inserting, looking up, deleting and iterating over the elements of Maps and
+// Sets keyed by numbers and strings.
+(function() {
+  var numIter = 20;
+  var size = 50000;
+  var keys = [];
+  for (var i = 0; i < size; i++) keys.push('key' + i);
+
+  var res = 0;
+  for (var iter = 0; iter < numIter; iter++) {
+    var m = new Map();
+    var s = new Set();
+    for (var i = 0; i < size; i++) {
+      m.set(keys[i], i);
+      s.add(i);
+    }
+    for (var i = 0; i < size; i++) {
+      res += m.get(keys[i]);
+      if (s.has(i * 2)) res++;
+    }
+    for (var i = 0; i < size; i += 2) {
+      m.delete(keys[i]);
+      s.delete(i);
+    }
+    m.forEach(function(v) {
+      res += v;
+    });
+    for (var v of s) res -= v;
+    res %= 1000000007;
+  }
+
+  print(res);
+  print('done');
+})();
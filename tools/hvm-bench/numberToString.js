@@ -0,0 +1,34 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @format
+ */
+
+// Number to string conversions: fractional numbers, which need the shortest
+// round trip digits, and small integers, through string concatenation,
+// Array.prototype.join and JSON.stringify.
+(function() {
+  var numIter = 200;
+  var len = 2000;
+  var fractions = [];
+  var ints = [];
+  for (var i = 0; i < len; i++) {
+    fractions.push(i / 7 + 0.1);
+    ints.push(i % 1000);
+  }
+
+  var totalLength = 0;
+  for (var i = 0; i < numIter; i++) {
+    for (var j = 0; j < len; j++) {
+      totalLength += ('' + fractions[j]).length;
+      totalLength += ('' + ints[j]).length;
+    }
+    totalLength += fractions.join().length;
+    totalLength += JSON.stringify(ints).length;
+  }
+
+  print(totalLength);
+})();
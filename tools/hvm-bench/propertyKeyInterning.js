@@ -0,0 +1,49 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @format
+ */
+
+// Interning computed property keys: every access with a string key which
+// isn't already a symbol hashes the string and looks it up in the identifier
+// table. Also looks up the same keys in a Map, which hashes string keys by
+// their contents.
+(function() {
+  var numKeys = 1000;
+  var numIter = 2000;
+  var prefixes = ['k', 'someLongerPropertyName_', 'ünïcödé_property_'];
+
+  var objs = [];
+  var maps = [];
+  var keys = [];
+  for (var p = 0; p < prefixes.length; p++) {
+    var o = {};
+    var m = new Map();
+    for (var k = 0; k < numKeys; k++) {
+      var key = prefixes[p] + k;
+      o[key] = k;
+      m.set(key, k);
+      keys.push(key);
+    }
+    objs.push(o);
+    maps.push(m);
+  }
+
+  var res = 0;
+  for (var i = 0; i < numIter; i++) {
+    for (var p = 0; p < prefixes.length; p++) {
+      var o = objs[p];
+      var m = maps[p];
+      for (var k = p * numKeys, e = k + numKeys; k < e; k++) {
+        res += o[keys[k]];
+        res += m.get(keys[k]);
+      }
+    }
+  }
+
+  print(res);
+  print('done');
+})();
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+//===----------------------------------------------------------------------===//
+/// \file
+/// This benchmark measures how many initialized runtimes can be created per
+/// second, first by creating each runtime and running an initialization script
+/// in it, then by instantiating each runtime from a RuntimeImage captured
+/// after running the same script once.
+///
+/// The initialization script is compiled once up front, so the first number
+/// does not include the cost of the compiler.
+//===----------------------------------------------------------------------===//
+#include "hermes/BCGen/HBC/BytecodeProviderFromSrc.h"
+#include "hermes/Support/MemoryBuffer.h"
+#include "hermes/VM/Callable.h"
+#include "hermes/VM/Runtime.h"
+#include "hermes/VM/RuntimeImage.h"
+
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/ManagedStatic.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/PrettyStackTrace.h"
+#include "llvm/Support/Signals.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <chrono>
+
+using namespace hermes;
+using namespace hermes::vm;
+
+static llvm::cl::opt<std::string> InputFilename{
+    llvm::cl::Positional,
+    llvm::cl::desc("<initialization script>"),
+    llvm::cl::init("")};
+static llvm::cl::opt<unsigned> NumRuntimes{
+    "n",
+    llvm::cl::desc("Number of runtimes to create in each mode"),
+    llvm::cl::init(200)};
+
+/// The initialization script used when none is given: it builds a few
+/// objects and functions, as the prelude of an application would.
+static const char kDefaultInit[] =
+    "var config = {};\n"
+    "for (var i = 0; i < 1000; ++i) config['key' + i] = [i, 'v' + i];\n"
+    "function lookup(k) { return config[k]; }\n"
+    "var util = { lookup: lookup, keys: Object.keys(config) };\n";
+
+namespace {
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  // Print a stack trace if we signal out.
+  llvm::sys::PrintStackTraceOnErrorSignal("Hermes driver");
+  llvm::PrettyStackTraceProgram X(argc, argv);
+  // Call llvm_shutdown() on exit to print stats and free memory.
+  llvm::llvm_shutdown_obj Y;
+  llvm::cl::ParseCommandLineOptions(argc, argv, "Hermes runtime clone bench\n");
+
+  std::unique_ptr<llvm::MemoryBuffer> source;
+  if (InputFilename.empty()) {
+    source = llvm::MemoryBuffer::getMemBuffer(kDefaultInit, "init.js");
+  } else {
+    auto fileOrErr = llvm::MemoryBuffer::getFile(InputFilename);
+    if (!fileOrErr) {
+      llvm::errs() << "Error: failed to open " << InputFilename << "\n";
+      return 1;
+    }
+    source = std::move(*fileOrErr);
+  }
+
+  auto bcErr = hbc::BCProviderFromSrc::createBCProviderFromSrc(
+      llvm::make_unique<OwnedMemoryBuffer>(std::move(source)),
+      "init.js",
+      hbc::CompileFlags{});
+  if (!bcErr.first) {
+    llvm::errs() << "Error: " << bcErr.second << "\n";
+    return 1;
+  }
+  std::shared_ptr<hbc::BCProvider> bytecode = std::move(bcErr.first);
+
+  const RuntimeConfig config;
+
+  /// Run the initialization script in \p runtime.
+  auto init = [&bytecode](Runtime *runtime) {
+    GCScope scope(runtime);
+    auto status = runtime->runBytecode(
+        std::shared_ptr<hbc::BCProvider>(bytecode),
+        RuntimeModuleFlags{},
+        "init.js",
+        Runtime::makeNullHandle<Environment>());
+    if (status == ExecutionStatus::EXCEPTION) {
+      runtime->printException(
+          llvm::errs(), runtime->makeHandle(runtime->getThrownValue()));
+      return false;
+    }
+    return true;
+  };
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < NumRuntimes; ++i) {
+    auto runtime = Runtime::create(config);
+    if (!init(runtime.get())) {
+      return 1;
+    }
+  }
+  double freshSecs = secondsSince(start);
+  llvm::outs() << "create + init: "
+               << llvm::format("%.0f", NumRuntimes / freshSecs)
+               << " runtimes/s\n";
+
+#ifdef HERMESVM_SERIALIZE
+  std::shared_ptr<const RuntimeImage> image;
+  {
+    auto runtime = Runtime::create(config);
+    if (!init(runtime.get())) {
+      return 1;
+    }
+    image = RuntimeImage::capture(runtime.get());
+  }
+
+  start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < NumRuntimes; ++i) {
+    image->instantiate(config);
+  }
+  double imageSecs = secondsSince(start);
+  llvm::outs() << "instantiate from image (" << image->size()
+               << " bytes): " << llvm::format("%.0f", NumRuntimes / imageSecs)
+               << " runtimes/s\n";
+#else
+  llvm::outs() << "instantiate from image: unavailable, "
+               << "build with HERMESVM_SERIALIZE\n";
+#endif
+  return 0;
+}
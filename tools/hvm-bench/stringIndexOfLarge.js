@@ -0,0 +1,30 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @format
+ */
+
+// Searching for short and long needles in a multi-megabyte log string, in both
+// directions, in ASCII and UTF-16 strings.
+(function() {
+  var line = '[INFO] 2020-01-01 12:00:00 request handled in 12ms by worker 7\n';
+  var ascii = line.repeat(50000) + '[ERROR] out of memory\n';
+  var utf16 = '☃' + ascii;
+  var numIter = 100;
+
+  var res = 0;
+  for (var i = 0; i < numIter; i++) {
+    res += ascii.indexOf('[ERROR]');
+    res += ascii.indexOf('out of memory');
+    res += ascii.lastIndexOf('2020-01-01 12:00:00 request handled in 13ms');
+    res += ascii.includes('!') ? 1 : 0;
+    res += utf16.indexOf('[ERROR]');
+    res += utf16.indexOf('☃ not there');
+  }
+
+  print(res);
+  print('done');
+})();
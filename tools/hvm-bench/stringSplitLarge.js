@@ -0,0 +1,27 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @format
+ */
+
+// Splitting a multi-megabyte CSV-like string into lines and fields.
+(function() {
+  var numIter = 10;
+  var row = '1024,some text here,3.14159,another field,2020-01-01T00:00:00\n';
+  var s = row.repeat(50000);
+
+  var count = 0;
+  for (var j = 0; j < numIter; j++) {
+    var lines = s.split('\n');
+    for (var i = 0; i < lines.length; i++) {
+      count += lines[i].split(',').length;
+    }
+    count += s.split('2020-01-01T00:00:00').length;
+  }
+
+  print(count);
+  print('done');
+})();
@@ -0,0 +1,34 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @format
+ */
+
+// String to number conversions of CSV-like fields with Number() and
+// parseFloat(), and of a JSON array of numbers with JSON.parse().
+(function() {
+  var numIter = 100;
+  var len = 5000;
+  var fields = [];
+  var doubles = [];
+  for (var i = 0; i < len; i++) {
+    fields.push(String(i * 37) + '.' + String(i % 100));
+    doubles.push(i / 7);
+  }
+  var json = JSON.stringify(doubles);
+
+  var sum = 0;
+  for (var i = 0; i < numIter; i++) {
+    for (var j = 0; j < len; j++) {
+      sum += Number(fields[j]);
+      sum += parseFloat(fields[j]);
+    }
+    var parsed = JSON.parse(json);
+    sum += parsed[parsed.length - 1];
+  }
+
+  print(sum);
+})();
@@ -0,0 +1,39 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @format
+ */
+
+// Sorting, searching, reversing and copying typed arrays without callbacks.
+(function() {
+  var numIter = 50;
+  var len = 100000;
+  var floats = new Float32Array(len);
+  var ints = new Int32Array(len);
+  var seed = 1;
+  for (var i = 0; i < len; i++) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    floats[i] = seed / 1000;
+    ints[i] = seed - 0x40000000;
+  }
+  var sortedFloats = new Float32Array(len);
+  var sortedInts = new Int32Array(len);
+  var doubles = new Float64Array(len);
+
+  var sum = 0;
+  for (var i = 0; i < numIter; i++) {
+    sortedFloats.set(floats);
+    sortedFloats.sort();
+    sortedInts.set(ints);
+    sortedInts.sort();
+    sortedInts.reverse();
+    doubles.set(ints);
+    sum += sortedInts.indexOf(ints[i]) + sortedFloats.lastIndexOf(floats[i]);
+    sum += doubles.includes(0.5) ? 1 : 0;
+  }
+
+  print(sum);
+})();
@@ -135,6 +135,33 @@ TEST_F(HermesRuntimeTest, PreparedJavaScriptBytecodeTest) {
   EXPECT_EQ(rt->global().getProperty(*rt, "q").getNumber(), 2);
 }
 
+TEST_F(HermesRuntimeTest, PreparedJavaScriptSharedBytecodeTest) {
+  std::string bytecode;
+  ASSERT_TRUE(hermes::compileJS(
+      "var shared = {caf\u00e9: 1, answer: 41}; shared.answer++;", bytecode));
+  auto prep =
+      rt->prepareJavaScript(std::make_unique<StringBuffer>(bytecode), "");
+  // Runtimes sharing the bytecode must all map its identifiers correctly,
+  // including those which are not ASCII.
+  for (int i = 0; i < 3; ++i) {
+    auto sharedRt = makeHermesRuntime();
+    sharedRt->evaluatePreparedJavaScript(prep);
+    EXPECT_EQ(
+        42,
+        sharedRt->global()
+            .getPropertyAsObject(*sharedRt, "shared")
+            .getProperty(*sharedRt, "answer")
+            .getNumber());
+    EXPECT_TRUE(sharedRt->global()
+                    .getPropertyAsFunction(*sharedRt, "eval")
+                    .call(
+                        *sharedRt,
+                        String::createFromUtf8(
+                            *sharedRt, "shared.caf\u00e9 === 1"))
+                    .getBool());
+  }
+}
+
 TEST_F(HermesRuntimeTest, PreparedJavaScriptInvalidSourceThrows) {
   const char *badSource = "this is definitely not valid javascript";
   bool caught = false;
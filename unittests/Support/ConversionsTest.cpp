@@ -7,6 +7,9 @@
 
 #include "hermes/Support/Conversions.h"
 
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <limits>
 
 #include "gtest/gtest.h"
@@ -163,6 +166,89 @@ TEST(ConversionsTest, numberToStringTest) {
   DoubleToStringTest("0", 0);
   DoubleToStringTest("12384", 12384);
   DoubleToStringTest("-12384", -12384);
+
+  // Shortest digits which round trip.
+  DoubleToStringTest("0.30000000000000004", 0.1 + 0.2);
+  DoubleToStringTest("0.1", 0.1);
+  DoubleToStringTest("1e+23", 1e23);
+  DoubleToStringTest("9007199254740992", 9007199254740993.0);
+  DoubleToStringTest("0.000001", 1e-6);
+  DoubleToStringTest("1e-7", 1e-7);
+  DoubleToStringTest("5e-324", std::numeric_limits<double>::denorm_min());
+  DoubleToStringTest(
+      "2.2250738585072014e-308", std::numeric_limits<double>::min());
+  DoubleToStringTest(
+      "1.7976931348623157e+308", std::numeric_limits<double>::max());
+}
+
+TEST(ConversionsTest, numberToStringRoundTripTest) {
+  char buf[NUMBER_TO_STRING_BUF_SIZE];
+  // Numbers from random bit patterns, so all exponents are covered.
+  uint64_t bits = 0x123456789ABCDEFull;
+  for (int i = 0; i < 100000; ++i) {
+    bits = bits * 6364136223846793005ull + 1442695040888963407ull;
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    if (std::isnan(value))
+      continue;
+    numberToString(value, buf, sizeof(buf));
+    EXPECT_EQ(value, std::strtod(buf, nullptr)) << buf;
+  }
+}
+
+TEST(ConversionsTest, parseDecimalPrefixTest) {
+  double result;
+
+#define ParseDecimalTest(expected, expectedLength, str)         \
+  do {                                                          \
+    const char *begin = str;                                    \
+    const char *end = parseDecimalPrefix(                       \
+        begin, begin + std::strlen(begin), result);             \
+    EXPECT_EQ(expectedLength, end - begin) << str;              \
+    if (expectedLength) {                                       \
+      EXPECT_EQ(expected, result) << str;                       \
+    }                                                           \
+  } while (0)
+
+  ParseDecimalTest(0.0, 0, "");
+  ParseDecimalTest(0.0, 0, "-");
+  ParseDecimalTest(0.0, 0, ".");
+  ParseDecimalTest(0.0, 0, "e5");
+  ParseDecimalTest(0.0, 0, "Infinity");
+  ParseDecimalTest(123.0, 3, "123");
+  ParseDecimalTest(-123.0, 4, "-123");
+  ParseDecimalTest(0.5, 2, ".5");
+  ParseDecimalTest(5.0, 2, "5.");
+  ParseDecimalTest(1.5e10, 6, "1.5e10x");
+  ParseDecimalTest(1.0, 1, "1e");
+  ParseDecimalTest(1.0, 1, "1e+");
+  ParseDecimalTest(1e-7, 4, "1e-7.");
+  ParseDecimalTest(0.0, 1, "0x10");
+  ParseDecimalTest(3.14, 4, "3.14.15");
+
+  // Beyond the exact fast path.
+  ParseDecimalTest(0.30000000000000004, 19, "0.30000000000000004");
+  ParseDecimalTest(1e23, 5, "1e+23");
+  ParseDecimalTest(9007199254740993.0, 16, "9007199254740993");
+  ParseDecimalTest(1.7976931348623157e308, 23, "1.7976931348623157e+308");
+  ParseDecimalTest(
+      std::numeric_limits<double>::infinity(), 23, "1.7976931348623159e+308");
+  ParseDecimalTest(5e-324, 6, "5e-324");
+  ParseDecimalTest(0.0, 6, "1e-400");
+  // More than 19 significant digits.
+  ParseDecimalTest(
+      123456789012345678901234567890.0, 30, "123456789012345678901234567890");
+  ParseDecimalTest(0.1, 25, "0.10000000000000000000001");
+
+  // Negative zero.
+  ParseDecimalTest(0.0, 2, "-0");
+  EXPECT_TRUE(std::signbit(result));
+
+#undef ParseDecimalTest
+
+  const char16_t str16[] = u"-2.5e-3";
+  EXPECT_EQ(str16 + 7, parseDecimalPrefix(str16, str16 + 7, result));
+  EXPECT_EQ(-2.5e-3, result);
 }
 
 } // end anonymous namespace
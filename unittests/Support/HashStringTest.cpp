@@ -8,6 +8,9 @@
 #include "hermes/Support/HashString.h"
 
 #include <limits>
+#include <random>
+#include <string>
+#include <unordered_set>
 
 #include "gtest/gtest.h"
 
@@ -26,4 +29,63 @@ TEST(HashStringTest, Constexpr) {
       hashString(makeArrayRef("1234567")), constexprHashString("1234567"));
 }
 
+TEST(HashStringTest, RuntimeConstexpr) {
+  EXPECT_EQ(
+      runtimeHashString(makeArrayRef("")), constexprRuntimeHashString(""));
+  EXPECT_EQ(
+      runtimeHashString(makeArrayRef("abc")),
+      constexprRuntimeHashString("abc"));
+  EXPECT_EQ(
+      runtimeHashString(makeArrayRef("abcd")),
+      constexprRuntimeHashString("abcd"));
+  EXPECT_EQ(
+      runtimeHashString(makeArrayRef("constructor")),
+      constexprRuntimeHashString("constructor"));
+  EXPECT_EQ(
+      runtimeHashString(makeArrayRef("\xff\x80 high bytes")),
+      constexprRuntimeHashString("\xff\x80 high bytes"));
+}
+
+TEST(HashStringTest, RuntimeASCIIMatchesUTF16) {
+  std::mt19937 rng{1};
+  for (size_t len = 0; len < 40; ++len) {
+    std::string ascii;
+    for (size_t i = 0; i < len; ++i)
+      ascii.push_back(rng() % 128);
+    std::u16string utf16(ascii.begin(), ascii.end());
+    EXPECT_EQ(
+        runtimeHashString(llvm::ArrayRef<char>{ascii.data(), len}),
+        runtimeHashString(llvm::ArrayRef<char16_t>{utf16.data(), len}));
+  }
+}
+
+TEST(HashStringTest, RuntimeDistinguishesLengthAndLanes) {
+  // Trailing NULs only differ in the length.
+  const char16_t withNul[] = {u'a', 0};
+  EXPECT_NE(
+      runtimeHashString(llvm::ArrayRef<char16_t>{withNul, 1}),
+      runtimeHashString(llvm::ArrayRef<char16_t>{withNul, 2}));
+  // A 16-bit code unit must not be confused with two 8-bit code units.
+  const char16_t wide[] = {0x6162};
+  EXPECT_NE(
+      runtimeHashString(llvm::ArrayRef<char16_t>{wide, 1}),
+      runtimeHashString(makeArrayRef("ba")));
+}
+
+TEST(HashStringTest, RuntimeLowBitsSpread) {
+  // The identifier table indexes with the low bits of the hash, so similar
+  // keys must spread over the buckets.
+  const unsigned kBits = 12;
+  const unsigned kKeys = 1u << kBits;
+  std::unordered_set<uint32_t> buckets{};
+  for (unsigned i = 0; i < kKeys; ++i) {
+    std::string key = "key" + std::to_string(i);
+    buckets.insert(
+        runtimeHashString(llvm::ArrayRef<char>{key.data(), key.size()}) &
+        (kKeys - 1));
+  }
+  // A random function would fill about 63% of the buckets.
+  EXPECT_GT(buckets.size(), kKeys / 2);
+}
+
 } // end anonymous namespace
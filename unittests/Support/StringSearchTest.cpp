@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "hermes/Support/StringSearch.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+namespace {
+
+using namespace hermes;
+
+/// Reference implementation of stringSearch().
+template <typename HayT, typename NeedleT>
+size_t naiveSearch(
+    const std::basic_string<HayT> &hay,
+    const std::basic_string<NeedleT> &needle,
+    size_t from) {
+  for (size_t pos = from; pos + needle.size() <= hay.size(); ++pos) {
+    if (std::equal(needle.begin(), needle.end(), hay.begin() + pos))
+      return pos;
+  }
+  return kStringSearchNoMatch;
+}
+
+/// Reference implementation of stringSearchBackward().
+template <typename HayT, typename NeedleT>
+size_t naiveSearchBackward(
+    const std::basic_string<HayT> &hay,
+    const std::basic_string<NeedleT> &needle,
+    size_t start) {
+  if (needle.size() > hay.size())
+    return kStringSearchNoMatch;
+  for (size_t pos = std::min(start, hay.size() - needle.size()) + 1;
+       pos-- > 0;) {
+    if (std::equal(needle.begin(), needle.end(), hay.begin() + pos))
+      return pos;
+  }
+  return kStringSearchNoMatch;
+}
+
+template <typename T>
+std::basic_string<T> randomString(std::mt19937 &rng, size_t len, T alpha) {
+  std::basic_string<T> str;
+  for (size_t i = 0; i < len; ++i)
+    str.push_back(alpha + rng() % 3);
+  return str;
+}
+
+/// Search for random needles over a small alphabet in \p hay, so that there
+/// are lots of partial matches, and compare with the reference.
+template <typename HayT, typename NeedleT>
+void checkRandomNeedles(
+    std::mt19937 &rng,
+    const std::basic_string<HayT> &hay,
+    NeedleT alpha) {
+  for (size_t len : {0, 1, 2, 3, 5, 8, 13, 40}) {
+    for (int iter = 0; iter < 20; ++iter) {
+      auto needle = randomString(rng, len, alpha);
+      llvm::ArrayRef<HayT> hayRef{hay.data(), hay.size()};
+      llvm::ArrayRef<NeedleT> needleRef{needle.data(), needle.size()};
+      for (size_t from : {(size_t)0, (size_t)7, hay.size() / 2, hay.size()}) {
+        EXPECT_EQ(
+            naiveSearch(hay, needle, from),
+            stringSearch(hayRef, needleRef, from));
+        EXPECT_EQ(
+            naiveSearchBackward(hay, needle, from),
+            stringSearchBackward(hayRef, needleRef, from));
+      }
+    }
+  }
+}
+
+/// Helpers to avoid commas in template arguments inside EXPECT_EQ.
+template <typename HayT, typename NeedleT>
+size_t search(
+    const std::basic_string<HayT> &hay,
+    const std::basic_string<NeedleT> &needle,
+    size_t from = 0) {
+  return stringSearch(
+      llvm::ArrayRef<HayT>{hay.data(), hay.size()},
+      llvm::ArrayRef<NeedleT>{needle.data(), needle.size()},
+      from);
+}
+template <typename HayT, typename NeedleT>
+size_t searchBackward(
+    const std::basic_string<HayT> &hay,
+    const std::basic_string<NeedleT> &needle,
+    size_t start = kStringSearchNoMatch) {
+  return stringSearchBackward(
+      llvm::ArrayRef<HayT>{hay.data(), hay.size()},
+      llvm::ArrayRef<NeedleT>{needle.data(), needle.size()},
+      start);
+}
+
+TEST(StringSearchTest, Basic) {
+  std::string hay{"hello world, hello"};
+  EXPECT_EQ(0u, search(hay, std::string("hello")));
+  EXPECT_EQ(13u, search(hay, std::string("hello"), 1));
+  EXPECT_EQ(4u, search(hay, std::string("o")));
+  EXPECT_EQ(kStringSearchNoMatch, search(hay, std::string("worlds")));
+  EXPECT_EQ(5u, search(hay, std::string(), 5));
+  EXPECT_EQ(kStringSearchNoMatch, search(hay, std::string(), hay.size() + 1));
+
+  EXPECT_EQ(13u, searchBackward(hay, std::string("hello")));
+  EXPECT_EQ(0u, searchBackward(hay, std::string("hello"), 12));
+  EXPECT_EQ(11u, searchBackward(hay, std::string(","), 12));
+  EXPECT_EQ(hay.size(), searchBackward(hay, std::string()));
+}
+
+TEST(StringSearchTest, MixedWidths) {
+  std::u16string hay16{u"ab\u0100cd\u0161"};
+  EXPECT_EQ(3u, search(hay16, std::string("cd")));
+  EXPECT_EQ(2u, search(hay16, std::u16string(u"\u0100c")));
+  EXPECT_EQ(5u, searchBackward(hay16, std::u16string(u"\u0161")));
+  // A code unit which can't be represented in the haystack never matches,
+  // even though its low byte does.
+  EXPECT_EQ(
+      kStringSearchNoMatch,
+      search(std::string("abcd"), std::u16string(u"\u0163d")));
+}
+
+TEST(StringSearchTest, RandomShort) {
+  std::mt19937 rng{1};
+  auto hay = randomString(rng, 100, 'a');
+  checkRandomNeedles(rng, hay, 'a');
+  checkRandomNeedles(rng, std::u16string(hay.begin(), hay.end()), 'a');
+}
+
+TEST(StringSearchTest, RandomLong) {
+  // Long enough haystacks to use Horspool for long needles.
+  std::mt19937 rng{2};
+  auto hay = randomString(rng, 3000, 'a');
+  checkRandomNeedles(rng, hay, 'a');
+  checkRandomNeedles(rng, hay, u'a');
+  // Code units which only differ in their high byte share skip table entries.
+  auto hay16 = randomString(rng, 3000, u'\u0161');
+  for (auto &c : hay16) {
+    if (rng() % 2)
+      c -= 0x100;
+  }
+  checkRandomNeedles(rng, hay16, u'\u0161');
+  checkRandomNeedles(rng, hay16, u'a');
+  checkRandomNeedles(rng, hay16, 'a');
+}
+
+} // namespace
@@ -13,6 +13,8 @@
 #include "hermes/VM/Handle.h"
 #include "hermes/VM/HermesValueTraits.h"
 
+#include <atomic>
+#include <thread>
 #include <vector>
 
 using namespace hermes::vm;
@@ -67,10 +69,50 @@ struct DummyCell final : public GCCell {
   DummyCell(GC *gc) : GCCell(gc, &vt) {}
 };
 
+/// The native resources released by ReleasingCell.
+struct NativeResource {
+  std::atomic<int> numReleased{0};
+  std::thread::id releaseThread{};
+};
+
+/// A cell whose finalizer releases a native resource through the GC.
+struct ReleasingCell final : public GCCell {
+  static const VTable vt;
+  NativeResource *resource;
+#ifdef HERMESVM_GC_HADES
+  // Some padding to meet the minimum cell size.
+  uint64_t padding1_{0};
+  uint64_t padding2_{0};
+#endif
+
+  static void finalize(GCCell *cell, GC *gc) {
+    auto *self = static_cast<ReleasingCell *>(cell);
+    gc->releaseNative(
+        [](void *context) {
+          auto *resource = static_cast<NativeResource *>(context);
+          resource->releaseThread = std::this_thread::get_id();
+          ++resource->numReleased;
+        },
+        self->resource);
+  }
+
+  static ReleasingCell *create(DummyRuntime &runtime, NativeResource *res) {
+    return new (runtime.allocWithFinalizer(sizeof(ReleasingCell)))
+        ReleasingCell(&runtime.getHeap(), res);
+  }
+
+  ReleasingCell(GC *gc, NativeResource *resource)
+      : GCCell(gc, &vt), resource(resource) {}
+};
+
 const VTable FinalizerCell::vt{CellKind::FillerCellKind,
                                sizeof(FinalizerCell),
                                FinalizerCell::finalize};
 
+const VTable ReleasingCell::vt{CellKind::FillerCellKind,
+                               sizeof(ReleasingCell),
+                               ReleasingCell::finalize};
+
 const VTable DummyCell::vt{CellKind::UninitializedKind, sizeof(DummyCell)};
 
 MetadataTableForTests getMetadataTable() {
@@ -181,4 +223,50 @@ TEST(GCFinalizerTest, FinalizeAllOnRuntimeDestructRealRuntime) {
   ASSERT_EQ(2, finalized);
 }
 
+TEST(GCFinalizerTest, ReleaseNativeInline) {
+  NativeResource resource;
+  auto runtime = DummyRuntime::create(getMetadataTable(), kTestGCConfigSmall);
+  DummyRuntime &rt = *runtime;
+  ASSERT_EQ(nullptr, rt.gc.getBackgroundFinalizer());
+
+  ReleasingCell::create(rt, &resource);
+  rt.gc.collect();
+
+  // Without background finalization, the release runs during the collection.
+  ASSERT_EQ(1, resource.numReleased);
+  ASSERT_EQ(std::this_thread::get_id(), resource.releaseThread);
+}
+
+TEST(GCFinalizerTest, ReleaseNativeInBackground) {
+  NativeResource dead;
+  NativeResource live;
+  auto runtime = DummyRuntime::create(
+      getMetadataTable(),
+      GCConfig::Builder(kTestGCConfigBaseBuilder)
+          .withInitHeapSize(kInitHeapSmall)
+          .withMaxHeapSize(kMaxHeapSmall)
+          .withBackgroundFinalization(true)
+          .build());
+  DummyRuntime &rt = *runtime;
+  BackgroundFinalizer *finalizer = rt.gc.getBackgroundFinalizer();
+  ASSERT_NE(nullptr, finalizer);
+
+  ReleasingCell::create(rt, &dead);
+  ReleasingCell::create(rt, &dead);
+  GCCell *r = ReleasingCell::create(rt, &live);
+  rt.pointerRoots.push_back(&r);
+  rt.gc.collect();
+  finalizer->drain();
+
+  ASSERT_EQ(2, dead.numReleased);
+  ASSERT_NE(std::this_thread::get_id(), dead.releaseThread);
+  ASSERT_EQ(0, live.numReleased);
+  ASSERT_EQ(2u, finalizer->numReleased());
+
+  // Releases added when the heap is destroyed are still run.
+  rt.pointerRoots.clear();
+  runtime.reset();
+  ASSERT_EQ(1, live.numReleased);
+}
+
 } // namespace
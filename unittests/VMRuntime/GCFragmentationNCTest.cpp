@@ -31,6 +31,8 @@ MetadataTableForTests getMetadataTable() {
           CellKind::DynamicASCIIStringPrimitiveKind,
           CellKind::BufferedUTF16StringPrimitiveKind,
           CellKind::BufferedASCIIStringPrimitiveKind,
+          CellKind::SlicedUTF16StringPrimitiveKind,
+          CellKind::SlicedASCIIStringPrimitiveKind,
           CellKind::DynamicUniquedUTF16StringPrimitiveKind,
           CellKind::DynamicUniquedASCIIStringPrimitiveKind,
           CellKind::ExternalUTF16StringPrimitiveKind,
@@ -44,6 +46,8 @@ MetadataTableForTests getMetadataTable() {
       Metadata(), // DynamicASCIIStringPrimitive
       Metadata(), // BufferedUTF16StringPrimitive
       Metadata(), // BufferedASCIIStringPrimitive
+      Metadata(), // SlicedUTF16StringPrimitive
+      Metadata(), // SlicedASCIIStringPrimitive
       Metadata(), // DynamicUniquedUTF16StringPrimitive
       Metadata(), // DynamicUniquedASCIIStringPrimitive
       Metadata(), // ExternalUTF16StringPrimitive
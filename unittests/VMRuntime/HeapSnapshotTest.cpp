@@ -20,6 +20,9 @@
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/raw_ostream.h"
 
+#include <map>
+#include <set>
+
 using namespace hermes::vm;
 using namespace hermes::parser;
 
@@ -923,6 +926,197 @@ global(2) @ test.js(4):11:4
 baz(3) @ test.js(4):9:31
 bar(4) @ test.js(4):6:20)#");
 }
+
+TEST_F(HeapSnapshotRuntimeTest, SamplingHeapProfile) {
+  // Sample every allocation so the test is deterministic.
+  runtime->enableSamplingHeapProfiler(1, 0);
+  hbc::CompileFlags flags;
+  CallResult<HermesValue> res = runtime->run(
+      R"#(
+var retained = [];
+function foo() {
+  for (var i = 0; i < 100; i++) {
+    retained.push({x: i});
+  }
+}
+function bar() {
+  for (var i = 0; i < 100; i++) {
+    ({y: i});
+  }
+}
+foo();
+bar();
+      )#",
+      "test.js",
+      flags);
+  ASSERT_FALSE(isException(res));
+  // Samples of dead objects must be dropped.
+  runtime->collect();
+
+  std::string result;
+  llvm::raw_string_ostream str(result);
+  runtime->disableSamplingHeapProfiler(str);
+  str.flush();
+  EXPECT_FALSE(runtime->getHeap().getSamplingAllocationTracker().isEnabled());
+  // Calls must no longer be tracked once the profile is written.
+  EXPECT_EQ(nullptr, runtime->getStackTracesTree());
+
+  JSONFactory::Allocator alloc;
+  JSONFactory jsonFactory{alloc};
+  SourceErrorManager sm;
+  JSONParser parser{jsonFactory, result, sm};
+  auto optProfile = parser.parse();
+  ASSERT_TRUE(optProfile.hasValue());
+  auto *profile = llvm::cast<JSONObject>(optProfile.getValue());
+
+  // Collect the total self size of every function in the tree.
+  std::map<std::string, double> sizeByFunction;
+  std::set<double> nodeIDs;
+  std::vector<const JSONObject *> nodeStack{
+      llvm::cast<JSONObject>(profile->at("head"))};
+  EXPECT_EQ(
+      llvm::cast<JSONString>(
+          llvm::cast<JSONObject>(nodeStack.back()->at("callFrame"))
+              ->at("functionName"))
+          ->str(),
+      "(root)");
+  while (!nodeStack.empty()) {
+    const JSONObject *node = nodeStack.back();
+    nodeStack.pop_back();
+    const auto *callFrame = llvm::cast<JSONObject>(node->at("callFrame"));
+    llvm::StringRef name =
+        llvm::cast<JSONString>(callFrame->at("functionName"))->str();
+    sizeByFunction[name.str()] +=
+        llvm::cast<JSONNumber>(node->at("selfSize"))->getValue();
+    nodeIDs.insert(llvm::cast<JSONNumber>(node->at("id"))->getValue());
+    for (const JSONValue *child : *llvm::cast<JSONArray>(node->at("children")))
+      nodeStack.push_back(llvm::cast<JSONObject>(child));
+  }
+  // Objects allocated by foo are still alive, those allocated by bar are not.
+  EXPECT_GT(sizeByFunction["foo"], 0);
+  EXPECT_EQ(sizeByFunction.count("bar"), 0u);
+
+  const auto &samples = *llvm::cast<JSONArray>(profile->at("samples"));
+  EXPECT_GE(samples.size(), 100u);
+  for (const JSONValue *sample : samples) {
+    const auto *sampleObj = llvm::cast<JSONObject>(sample);
+    EXPECT_EQ(
+        nodeIDs.count(
+            llvm::cast<JSONNumber>(sampleObj->at("nodeId"))->getValue()),
+        1u);
+  }
+}
+
+TEST_F(HeapSnapshotRuntimeTest, SamplingHeapProfileKeepsAllocationTraces) {
+  runtime->enableAllocationLocationTracker();
+  runtime->enableSamplingHeapProfiler(1, 0);
+  JSONFactory::Allocator alloc;
+  JSONFactory jsonFactory{alloc};
+  hbc::CompileFlags flags;
+  CallResult<HermesValue> res = runtime->run(
+      R"#(
+function foo() {
+  return new Object();
+}
+foo();
+      )#",
+      "test.js",
+      flags);
+  ASSERT_FALSE(isException(res));
+  ASSERT_TRUE(res->isObject());
+  Handle<JSObject> resObj = runtime->makeHandle(vmcast<JSObject>(*res));
+  auto fooObjID = runtime->getHeap().getObjectID(resObj.get());
+
+  std::string result;
+  llvm::raw_string_ostream str(result);
+  runtime->disableSamplingHeapProfiler(str);
+  // The allocation location tracker still uses the tree.
+  ASSERT_NE(nullptr, runtime->getStackTracesTree());
+  runtime->disableAllocationLocationTracker();
+  runtime->collect();
+  // Old allocations still refer to the tree.
+  ASSERT_NE(nullptr, runtime->getStackTracesTree());
+
+  JSONObject *root = TAKE_SNAPSHOT(runtime->getHeap(), jsonFactory);
+  ASSERT_NE(root, nullptr);
+  const JSONArray &nodes = *llvm::cast<JSONArray>(root->at("nodes"));
+  const JSONArray &strings = *llvm::cast<JSONArray>(root->at("strings"));
+  const JSONArray &traceFunctionInfos =
+      *llvm::cast<JSONArray>(root->at("trace_function_infos"));
+  std::map<int, ChromeStackTreeNode *> idNodeMap;
+  auto roots = ChromeStackTreeNode::parse(
+      *llvm::cast<JSONArray>(root->at("trace_tree")), nullptr, idNodeMap);
+  auto fooAllocNode = FIND_NODE_FOR_ID(fooObjID, nodes, strings);
+  auto fooStackTreeNode = idNodeMap.find(fooAllocNode.traceNodeID);
+  ASSERT_NE(fooStackTreeNode, idNodeMap.end());
+  EXPECT_STREQ(
+      fooStackTreeNode->second->buildStackTrace(traceFunctionInfos, strings)
+          .c_str(),
+      R"#(
+global(1) @ test.js(4):2:1
+global(2) @ test.js(4):5:4
+foo(3) @ test.js(4):3:20)#");
+}
+
+TEST_F(HeapSnapshotRuntimeTest, AllocationTracesKeepSamplingHeapProfile) {
+  runtime->enableSamplingHeapProfiler(1, 0);
+  runtime->enableAllocationLocationTracker();
+  hbc::CompileFlags flags;
+  CallResult<HermesValue> res = runtime->run(
+      R"#(
+var retained = [];
+function foo() {
+  retained.push({x: 1});
+}
+foo();
+      )#",
+      "test.js",
+      flags);
+  ASSERT_FALSE(isException(res));
+
+  runtime->disableAllocationLocationTracker(true);
+  // The sampling heap profiler still uses the tree.
+  ASSERT_NE(nullptr, runtime->getStackTracesTree());
+  res = runtime->run(
+      R"#(
+function bar() {
+  retained.push({y: 1});
+}
+bar();
+      )#",
+      "test2.js",
+      flags);
+  ASSERT_FALSE(isException(res));
+  runtime->collect();
+
+  std::string result;
+  llvm::raw_string_ostream str(result);
+  runtime->disableSamplingHeapProfiler(str);
+  str.flush();
+  EXPECT_EQ(nullptr, runtime->getStackTracesTree());
+
+  JSONFactory::Allocator alloc;
+  JSONFactory jsonFactory{alloc};
+  SourceErrorManager sm;
+  JSONParser parser{jsonFactory, result, sm};
+  auto optProfile = parser.parse();
+  ASSERT_TRUE(optProfile.hasValue());
+  auto *profile = llvm::cast<JSONObject>(optProfile.getValue());
+  std::set<std::string> functions;
+  std::vector<const JSONObject *> nodeStack{
+      llvm::cast<JSONObject>(profile->at("head"))};
+  while (!nodeStack.empty()) {
+    const JSONObject *node = nodeStack.back();
+    nodeStack.pop_back();
+    const auto *callFrame = llvm::cast<JSONObject>(node->at("callFrame"));
+    functions.insert(
+        llvm::cast<JSONString>(callFrame->at("functionName"))->str().str());
+    for (const JSONValue *child : *llvm::cast<JSONArray>(node->at("children")))
+      nodeStack.push_back(llvm::cast<JSONObject>(child));
+  }
+  EXPECT_EQ(functions.count("foo"), 1u);
+  EXPECT_EQ(functions.count("bar"), 1u);
+}
 #endif // HERMES_ENABLE_DEBUGGER
 
 } // namespace heapsnapshottest
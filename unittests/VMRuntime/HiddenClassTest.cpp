@@ -464,4 +464,66 @@ TEST_F(HiddenClassTest, ReservedSlots) {
   }
 }
 
+TEST_F(HiddenClassTest, AlwaysCacheableDictionary) {
+  GCScope gcScope{runtime, "HiddenClassTest.AlwaysCacheableDictionary", 32};
+  auto aHnd = *runtime->getIdentifierTable().getSymbolHandle(
+      runtime, createUTF16Ref(u"a"));
+  auto bHnd = *runtime->getIdentifierTable().getSymbolHandle(
+      runtime, createUTF16Ref(u"b"));
+
+  auto rootHnd = runtime->makeHandle<HiddenClass>(
+      runtime->ignoreAllocationFailure(HiddenClass::createRoot(runtime)));
+  MutableHandle<HiddenClass> clazz{
+      runtime, *HiddenClass::copyToAlwaysCacheableDictionary(rootHnd, runtime)};
+  ASSERT_TRUE(clazz->isDictionary());
+  ASSERT_TRUE(clazz->isDictionaryAlwaysCacheable());
+  ASSERT_TRUE(clazz->isWriteCacheable());
+
+  // Adding properties happens in place.
+  for (auto *hnd : {&aHnd, &bHnd}) {
+    auto addRes = HiddenClass::addProperty(
+        clazz, runtime, **hnd, PropertyFlags::defaultNewNamedPropertyFlags());
+    ASSERT_RETURNED(addRes);
+    ASSERT_EQ(*clazz, *addRes->first);
+  }
+
+  // Updating or deleting a property, any number of times, produces a new
+  // cacheable class.
+  for (unsigned i = 0; i < 3; ++i) {
+    NamedPropertyDescriptor desc;
+    auto pos = HiddenClass::findProperty(
+        clazz, runtime, *aHnd, PropertyFlags::invalid(), desc);
+    ASSERT_TRUE(pos);
+    desc.flags.writable = !desc.flags.writable;
+    auto updated = HiddenClass::updateProperty(clazz, runtime, *pos, desc.flags);
+    ASSERT_NE(*clazz, *updated);
+    ASSERT_FALSE(updated->isDictionaryNoCache());
+    ASSERT_TRUE(updated->isDictionaryAlwaysCacheable());
+    clazz = *updated;
+  }
+  NamedPropertyDescriptor desc;
+  auto pos = HiddenClass::findProperty(
+      clazz, runtime, *bHnd, PropertyFlags::invalid(), desc);
+  ASSERT_TRUE(pos);
+  auto deleted = HiddenClass::deleteProperty(clazz, runtime, *pos);
+  ASSERT_NE(*clazz, *deleted);
+  ASSERT_FALSE(deleted->isDictionaryNoCache());
+  ASSERT_TRUE(deleted->isDictionaryAlwaysCacheable());
+  ASSERT_EQ(1u, deleted->getNumProperties());
+  clazz = *deleted;
+
+  auto flagsUpdated = HiddenClass::updatePropertyFlagsWithoutTransitions(
+      clazz,
+      runtime,
+      PropertyFlags{},
+      PropertyFlags{},
+      llvm::None);
+  ASSERT_NE(*clazz, *flagsUpdated);
+  ASSERT_TRUE(flagsUpdated->isDictionaryAlwaysCacheable());
+
+  // The global object uses such a class.
+  ASSERT_TRUE(
+      runtime->getGlobal()->getClass(runtime)->isDictionaryAlwaysCacheable());
+}
+
 } // namespace
@@ -6,6 +6,8 @@
  */
 
 #include "hermes/VM/IdentifierTable.h"
+#include "hermes/BCGen/HBC/BytecodeProviderFromSrc.h"
+#include "hermes/Public/Buffer.h"
 #include "hermes/Support/UTF8.h"
 #include "hermes/VM/StringPrimitive.h"
 #include "hermes/VM/StringRefUtils.h"
@@ -130,6 +132,50 @@ TEST_F(IdentifierTableTest, LazyExternalSymbolTooBig) {
 #endif
 }
 
+TEST_F(IdentifierTableTest, SharedRuntimeIdentifierHashes) {
+  static const char src[] =
+      "var shared = {caf\u00e9: 1, answer: 41}; shared.answer++;";
+  hbc::CompileFlags flags;
+  auto bytecodeErr = hbc::BCProviderFromSrc::createBCProviderFromSrc(
+      llvm::make_unique<hermes::Buffer>(
+          reinterpret_cast<const uint8_t *>(src), sizeof(src) - 1),
+      "test.js",
+      flags);
+  ASSERT_TRUE(bytecodeErr.first) << bytecodeErr.second;
+  std::shared_ptr<hbc::BCProvider> bytecode = std::move(bytecodeErr.first);
+
+  auto res = runtime->runBytecode(
+      std::shared_ptr<hbc::BCProvider>{bytecode},
+      RuntimeModuleFlags{},
+      "test.js",
+      Runtime::makeNullHandle<Environment>());
+  ASSERT_FALSE(isException(res));
+  EXPECT_EQ(41, res->getNumber());
+  auto hashes = bytecode->getRuntimeIdentifierHashes();
+  ASSERT_FALSE(hashes.empty());
+
+  // Another runtime loading the same bytecode reuses the hashes computed for
+  // the first one, and still maps every identifier correctly.
+  auto otherRt = Runtime::create(kTestRTConfig);
+  {
+    GCScope scope{otherRt.get()};
+    res = otherRt->runBytecode(
+        std::shared_ptr<hbc::BCProvider>{bytecode},
+        RuntimeModuleFlags{},
+        "test.js",
+        Runtime::makeNullHandle<Environment>());
+    ASSERT_FALSE(::hermes::vm::isException(otherRt.get(), res));
+    EXPECT_EQ(41, res->getNumber());
+    res = otherRt->run(
+        "shared.answer === 42 && shared.caf\u00e9 === 1",
+        "check.js",
+        flags);
+    ASSERT_FALSE(::hermes::vm::isException(otherRt.get(), res));
+    EXPECT_TRUE(res->getBool());
+  }
+  EXPECT_EQ(hashes.data(), bytecode->getRuntimeIdentifierHashes().data());
+}
+
 // Verifies that SymbolIDs are allocated consecutively, increasing from zero, as
 // long as none have been freed.
 TEST_F(IdentifierTableTest, ConsecutiveIncreasingSymbolIDAlloc) {
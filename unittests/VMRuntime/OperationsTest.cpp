@@ -489,6 +489,23 @@ TEST_F(OperationsTest, ToStringTest) {
     SmallIntToStringTest(u"0", 0);
     SmallIntToStringTest(u"12384", 12384);
     SmallIntToStringTest(u"-12384", -12384);
+    SmallIntToStringTest(u"7", 7);
+    SmallIntToStringTest(u"1023", 1023);
+    SmallIntToStringTest(u"1024", 1024);
+  }
+
+  // Small integers are converted to the same cached string every time.
+  {
+    auto num = runtime->makeHandle(HermesValue::encodeNumberValue(42));
+    auto first = toString_RJS(runtime, num);
+    ASSERT_EQ(ExecutionStatus::RETURNED, first.getStatus());
+    auto firstStr = runtime->makeHandle(std::move(*first));
+    runtime->collect();
+    auto second = toString_RJS(runtime, num);
+    ASSERT_EQ(ExecutionStatus::RETURNED, second.getStatus());
+    EXPECT_EQ(firstStr.get(), second->get());
+    EXPECT_TRUE(StringPrimitive::createStringView(runtime, firstStr)
+                    .equals(createUTF16Ref(u"42")));
   }
 
   // TODO: Test Object toString once Runtime::interpretFunction() is written.
@@ -8,6 +8,7 @@
 #ifdef HERMESVM_SERIALIZE
 #include "hermes/VM/Serializer.h"
 #include "hermes/VM/Deserializer.h"
+#include "hermes/VM/RuntimeImage.h"
 
 #include "TestHelpers.h"
 
@@ -135,5 +136,41 @@ TEST_F(SerializerTest, SerializeDeserializeTest) {
   ASSERT_EQ(n6->function_(n6->value_), testFunction2(n2.value_));
   ASSERT_EQ(n7->function_(n7->value_), testFunction3(n3.value_));
 }
+
+/// \return the global property "x" of \p runtime.
+static HermesValue getGlobalX(Runtime *runtime) {
+  GCScope scope(runtime);
+  auto xHnd = *runtime->getIdentifierTable().getSymbolHandle(
+      runtime, createASCIIRef("x"));
+  return JSObject::getNamed_RJS(runtime->getGlobal(), runtime, *xHnd)->get();
+}
+
+/// Set the global property "x" of \p runtime to \p value.
+static void setGlobalX(Runtime *runtime, double value) {
+  GCScope scope(runtime);
+  auto xHnd = *runtime->getIdentifierTable().getSymbolHandle(
+      runtime, createASCIIRef("x"));
+  ASSERT_TRUE(*JSObject::putNamed_RJS(
+      runtime->getGlobal(),
+      runtime,
+      *xHnd,
+      runtime->makeHandle(HermesValue::encodeNumberValue(value))));
+}
+
+TEST_F(SerializerTest, RuntimeImageTest) {
+  setGlobalX(runtime, 42);
+  auto image = RuntimeImage::capture(runtime);
+  ASSERT_NE(0u, image->size());
+
+  // Each runtime instantiated from the image starts with the captured heap,
+  // and does not see the changes made to the others.
+  auto clone1 = image->instantiate(kTestRTConfigLargeHeap);
+  auto clone2 = image->instantiate(kTestRTConfigLargeHeap);
+  EXPECT_EQ(42.0, getGlobalX(clone1.get()).getNumber());
+  setGlobalX(clone1.get(), 1);
+  EXPECT_EQ(1.0, getGlobalX(clone1.get()).getNumber());
+  EXPECT_EQ(42.0, getGlobalX(clone2.get()).getNumber());
+  EXPECT_EQ(42.0, getGlobalX(runtime).getNumber());
+}
 } // namespace
 #endif
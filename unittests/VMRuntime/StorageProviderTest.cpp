@@ -11,6 +11,7 @@
 #include "hermes/Support/OSCompat.h"
 #include "hermes/VM/AlignedStorage.h"
 #include "hermes/VM/LimitedStorageProvider.h"
+#include "hermes/VM/SegmentPool.h"
 
 #include "llvm/ADT/STLExtras.h"
 
@@ -82,6 +83,35 @@ TEST(StorageProviderTest, StorageProviderFailedAllocsLogCount) {
   EXPECT_EQ(0, provider->numLiveAllocs());
 }
 
+TEST(StorageProviderTest, HugePageProviderAllocates) {
+  auto provider{StorageProvider::hugePageProvider(
+      /*prefault*/ true, /*preferLocalNUMANode*/ true)};
+
+  auto result = provider->newStorage("Test");
+  ASSERT_TRUE(result);
+  void *s = result.get();
+  EXPECT_EQ(s, AlignedStorage::start(s));
+  // Prefaulted storage must still read as zero, and be writable.
+  auto *bytes = static_cast<char *>(s);
+  EXPECT_EQ(0, bytes[0]);
+  EXPECT_EQ(0, bytes[AlignedStorage::size() - 1]);
+  bytes[AlignedStorage::size() / 2] = 1;
+
+  // Whether huge pages are used depends on the OS, but they can't cover more
+  // than the live storage.
+  auto hugePageBytes = provider->hugePageBytes();
+  if (hugePageBytes) {
+    EXPECT_LE(*hugePageBytes, AlignedStorage::size());
+  }
+
+  provider->deleteStorage(s);
+  EXPECT_EQ(0, provider->numLiveAllocs());
+  hugePageBytes = provider->hugePageBytes();
+  if (hugePageBytes) {
+    EXPECT_EQ(0, *hugePageBytes);
+  }
+}
+
 TEST(StorageProviderTest, LimitedStorageProviderEnforce) {
   constexpr size_t LIM = 2;
   LimitedStorageProvider provider{
@@ -181,6 +211,91 @@ TEST(StorageProviderTest, StorageProviderAllocsCount) {
   EXPECT_EQ(LIM, provider->numDeletedAllocs());
 }
 
+TEST(StorageProviderTest, SegmentPoolHandsOffStorage) {
+  auto pool = std::make_shared<SegmentPool>(StorageProvider::mmapProvider(), 1);
+  PooledStorageProvider first{pool};
+  PooledStorageProvider second{pool};
+
+  auto result = first.newStorage("First");
+  ASSERT_TRUE(result);
+  void *s = result.get();
+  first.deleteStorage(s);
+  EXPECT_EQ(1, pool->numPooled());
+
+  // The storage deleted by the first provider is reused by the second, and
+  // each provider only counts its own storage.
+  result = second.newStorage("Second");
+  ASSERT_TRUE(result);
+  EXPECT_EQ(s, result.get());
+  EXPECT_EQ(1, pool->numReused());
+  EXPECT_EQ(0, pool->numPooled());
+  EXPECT_EQ(0, first.numLiveAllocs());
+  EXPECT_EQ(1, second.numLiveAllocs());
+
+  // Pooled storage must be usable again.
+  static_cast<char *>(result.get())[0] = 1;
+  second.deleteStorage(result.get());
+}
+
+TEST(StorageProviderTest, SegmentPoolCap) {
+  auto pool = std::make_shared<SegmentPool>(StorageProvider::mmapProvider(), 1);
+  PooledStorageProvider provider{pool};
+
+  void *storages[3];
+  for (auto &s : storages) {
+    auto result = provider.newStorage();
+    ASSERT_TRUE(result);
+    s = result.get();
+  }
+  for (auto s : storages) {
+    provider.deleteStorage(s);
+  }
+  // Only one storage is kept, the others are deleted.
+  EXPECT_EQ(1, pool->numPooled());
+
+  pool->raiseMaxPooled(3);
+  for (auto &s : storages) {
+    auto result = provider.newStorage();
+    ASSERT_TRUE(result);
+    s = result.get();
+  }
+  for (auto s : storages) {
+    provider.deleteStorage(s);
+  }
+  EXPECT_EQ(3, pool->numPooled());
+}
+
+TEST(StorageProviderTest, LimitedStorageProviderOverSegmentPool) {
+  constexpr size_t LIM = 2;
+  auto pool =
+      std::make_shared<SegmentPool>(StorageProvider::mmapProvider(), LIM);
+  // Fill the pool from another runtime's provider, so the limited provider
+  // only gets pooled storage.
+  {
+    PooledStorageProvider other{pool};
+    void *storages[LIM];
+    for (auto &s : storages) {
+      auto result = other.newStorage();
+      ASSERT_TRUE(result);
+      s = result.get();
+    }
+    for (auto s : storages) {
+      other.deleteStorage(s);
+    }
+  }
+  ASSERT_EQ(LIM, pool->numPooled());
+
+  LimitedStorageProvider provider{
+      llvm::make_unique<PooledStorageProvider>(pool),
+      AlignedStorage::size() * (LIM - 1),
+  };
+  auto result = provider.newStorage();
+  ASSERT_TRUE(result);
+  // The limit applies to this provider, even though the pool has more.
+  EXPECT_FALSE(provider.newStorage());
+  provider.deleteStorage(result.get());
+}
+
 /// StorageGuard will free storage on scope exit.
 class StorageGuard final {
  public:
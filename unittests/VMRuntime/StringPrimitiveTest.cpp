@@ -324,4 +324,77 @@ TEST_F(StringPrimTest, FastConcatTest) {
   EXPECT_TRUE(utf16Ref.size() == utfStr3.size());
   EXPECT_TRUE(std::equal(utfStr3.begin(), utfStr3.end(), utf16Ref.begin()));
 }
+
+TEST_F(StringPrimTest, SliceTest) {
+  auto slice = [&](Handle<StringPrimitive> str, size_t start, size_t length) {
+    auto cr = StringPrimitive::slice(runtime, str, start, length);
+    EXPECT_NE(ExecutionStatus::EXCEPTION, cr);
+    return runtime->makeHandle<StringPrimitive>(*cr);
+  };
+  auto contents = [](Handle<StringPrimitive> str) {
+    auto ref = str->getStringRef<char>();
+    return std::string(ref.begin(), ref.end());
+  };
+  const uint32_t minLen = StringPrimitive::SLICED_STRING_MIN_SIZE;
+
+  std::string asciiStr;
+  for (unsigned i = 0; i < 200; ++i)
+    asciiStr.push_back('a' + i % 26);
+  auto ascii = StringPrimitive::createNoThrow(runtime, asciiStr);
+
+  // Slicing the whole string returns it.
+  EXPECT_EQ(ascii.get(), slice(ascii, 0, asciiStr.size()).get());
+
+  // Short slices are copied.
+  auto shortSlice = slice(ascii, 10, minLen - 1);
+  EXPECT_FALSE(vmisa<SlicedASCIIStringPrimitive>(shortSlice.get()));
+  EXPECT_EQ(asciiStr.substr(10, minLen - 1), contents(shortSlice));
+
+  // Long slices reference the original string.
+  auto longSlice = slice(ascii, 10, 100);
+  ASSERT_TRUE(vmisa<SlicedASCIIStringPrimitive>(longSlice.get()));
+  EXPECT_EQ(
+      ascii.get(),
+      vmcast<SlicedASCIIStringPrimitive>(longSlice.get())->getParent());
+  EXPECT_EQ(asciiStr.substr(10, 100), contents(longSlice));
+
+  // A slice of a slice references the original string too.
+  auto nestedSlice = slice(longSlice, 20, 50);
+  ASSERT_TRUE(vmisa<SlicedASCIIStringPrimitive>(nestedSlice.get()));
+  auto *nested = vmcast<SlicedASCIIStringPrimitive>(nestedSlice.get());
+  EXPECT_EQ(ascii.get(), nested->getParent());
+  EXPECT_EQ(30u, nested->getOffset());
+
+  // The contents are still correct after the strings have been moved.
+  runtime->collect();
+  EXPECT_EQ(asciiStr.substr(30, 50), contents(nestedSlice));
+  EXPECT_TRUE(nestedSlice->equals(slice(ascii, 30, 50).get()));
+
+  // UTF-16 strings.
+  std::u16string utf16Str(asciiStr.begin(), asciiStr.end());
+  utf16Str[0] = u'\u1234';
+  auto utf16 = StringPrimitive::createNoThrow(
+      runtime, UTF16Ref(utf16Str.data(), utf16Str.size()));
+  auto utf16Slice = slice(utf16, 0, 100);
+  ASSERT_TRUE(vmisa<SlicedUTF16StringPrimitive>(utf16Slice.get()));
+  auto utf16Ref = utf16Slice->getStringRef<char16_t>();
+  EXPECT_TRUE(std::equal(utf16Ref.begin(), utf16Ref.end(), utf16Str.begin()));
+}
+
+TEST_F(StringPrimTest, SliceHugeStringTest) {
+  // Small slices of huge strings are copied, so they don't keep the huge
+  // string alive.
+  std::string hugeStr(StringPrimitive::EXTERNAL_STRING_THRESHOLD * 2, 'x');
+  auto huge = StringPrimitive::createNoThrow(runtime, hugeStr);
+  uint32_t maxRetainingLength =
+      hugeStr.size() / StringPrimitive::SLICED_STRING_MAX_PARENT_RATIO;
+
+  auto cr = StringPrimitive::slice(runtime, huge, 1, maxRetainingLength / 2);
+  ASSERT_NE(ExecutionStatus::EXCEPTION, cr);
+  EXPECT_FALSE(vmisa<SlicedASCIIStringPrimitive>(cr->getString()));
+
+  cr = StringPrimitive::slice(runtime, huge, 1, maxRetainingLength);
+  ASSERT_NE(ExecutionStatus::EXCEPTION, cr);
+  EXPECT_TRUE(vmisa<SlicedASCIIStringPrimitive>(cr->getString()));
+}
 } // namespace